@@ -0,0 +1,89 @@
+#ifndef BASE_GRAPH_BREADTH_FIRST_SEARCH_H
+#define BASE_GRAPH_BREADTH_FIRST_SEARCH_H
+
+#include <cstdint>
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+
+
+namespace BaseGraph{
+
+// Direction-optimizing breadth-first search (Beamer, Asanovic and Patterson, 2012).
+// Small frontiers are expanded top-down from a queue. When the edges leaving the
+// frontier outnumber a fraction of the unexplored edges, the search switches to
+// bottom-up steps: every unvisited vertex looks for a parent among its in edges,
+// with the frontier stored as a bitmap. The in edges are stored contiguously and
+// built on the first bottom-up step.
+//
+// The object is a workspace that keeps its buffers between runs and can be reused
+// for many sources of the same graph: a run only resets the vertices visited by the
+// previous one. The graph must not be modified while it is in use.
+//
+// runBidirectional searches from the source along out edges and from the destination
+// along in edges, expanding the smallest frontier by a whole level until the searches
+// meet. It reuses the same buffers, so a point-to-point query only costs the vertices
+// it reaches. The in edges of a DirectedGraph are built once per workspace.
+template <typename T>
+class BreadthFirstSearch {
+    public:
+        // Switch to bottom-up when frontierEdges > unexploredEdges/ALPHA and back to
+        // top-down when the frontier shrinks below vertexNumber/BETA.
+        static const size_t ALPHA = 14;
+        static const size_t BETA = 24;
+
+        explicit BreadthFirstSearch(const T& graph): graph(graph) {}
+
+        void run(VertexIndex source);
+        void runBidirectional(VertexIndex source, VertexIndex destination);
+        const T& getGraph() const { return graph; }
+
+        const std::vector<size_t>& getDistances() const { return distances; }
+        const std::vector<VertexIndex>& getPredecessors() const { return predecessors; }
+        // Vertices reached by the last run, in order of increasing distance
+        const std::vector<VertexIndex>& getVisitedVertices() const { return visitedVertices; }
+
+        // After runBidirectional, the distances, predecessors and visited vertices only
+        // cover the forward side. A shortest path goes through the meeting vertex
+        // (SIZE_T_MAX when the destination is unreachable), then follows the successors
+        // found by the backward side up to the destination.
+        VertexIndex getMeetingVertex() const { return meetingVertex; }
+        const std::vector<VertexIndex>& getSuccessors() const { return successors; }
+
+    private:
+        const T& graph;
+
+        std::vector<size_t> distances;
+        std::vector<VertexIndex> predecessors;
+        std::vector<VertexIndex> visitedVertices;
+        size_t edgesNumber = 0;
+
+        std::vector<VertexIndex> frontier, nextFrontier;
+        std::vector<uint64_t> frontierBitmap, nextFrontierBitmap;
+
+        std::vector<size_t> inEdgesOffsets;
+        std::vector<VertexIndex> inEdges;
+
+        // Backward side of runBidirectional
+        std::vector<size_t> backwardDistances;
+        std::vector<VertexIndex> successors;
+        std::vector<VertexIndex> backwardVisitedVertices;
+        std::vector<VertexIndex> backwardFrontier;
+        VertexIndex meetingVertex = SIZE_T_MAX;
+
+        size_t topDownStep(size_t depth);
+        size_t bottomUpStep(size_t depth);
+        void expandBidirectionalLevel(bool forward, size_t depth, size_t& pathLength);
+        void buildInEdges();
+        void reset(VertexIndex source);
+        void resetBackward(VertexIndex destination);
+
+        static bool isInBitmap(const std::vector<uint64_t>& bitmap, VertexIndex vertex) {
+            return (bitmap[vertex/64] >> (vertex%64)) & 1; }
+        static void addToBitmap(std::vector<uint64_t>& bitmap, VertexIndex vertex) {
+            bitmap[vertex/64] |= uint64_t(1) << (vertex%64); }
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef BASE_GRAPH_COMPONENTS_H
+#define BASE_GRAPH_COMPONENTS_H
+
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+#include "BaseGraph/undirectedgraph.h"
+
+
+namespace BaseGraph{
+
+// Component of every vertex. The components are numbered in increasing order of
+// their smallest vertex.
+struct ComponentLabels {
+    std::vector<size_t> labels;
+    std::vector<size_t> sizes;
+
+    size_t getComponentNumber() const { return sizes.size(); }
+};
+
+// Labels the connected components in O(V+E). With threadNumber != 1 (0 uses every
+// hardware thread), the components are found by Afforest (Sutton, Ben-Nun and
+// Bar-Noy, 2018): a concurrent union-find first links every vertex to its first
+// neighbours, then skips the edges of the vertices that already belong to the
+// largest component. The labels do not depend on the number of threads.
+ComponentLabels findConnectedComponentLabels(const UndirectedGraph& graph, size_t threadNumber=1);
+
+// Components of the graph without edge directions, found with a concurrent
+// union-find over the out edges so that the in edges are never built.
+ComponentLabels findWeaklyConnectedComponents(const DirectedGraph& graph, size_t threadNumber=1);
+
+// With threadNumber=1, the strongly connected components are found by Tarjan's
+// algorithm with an explicit stack instead of recursion. Otherwise, the vertices
+// without in or out edges are trimmed and the others are split by forward-backward
+// searches (Fleischer, Hendrickson and Pinar, 2000): the vertices both reachable
+// from and reaching a pivot form its component, and the vertices reached in only
+// one direction or in none form three independent subproblems handed to the threads.
+ComponentLabels findStronglyConnectedComponents(const DirectedGraph& graph, size_t threadNumber=1);
+
+// Graph whose vertices are the components and with an edge between two components
+// when an edge of the graph joins them. For strongly connected components, it is a
+// directed acyclic graph.
+DirectedGraph getCondensationGraph(const DirectedGraph& graph, const ComponentLabels& components);
+
+// Connected components of an undirected graph maintained while edges are added,
+// using a union-find with path halving and union by size. The edges must be added
+// through this object: the removal of edges is not supported. Vertices added to the
+// graph with resize are isolated components from the next insertion on.
+class IncrementalComponents {
+    public:
+        explicit IncrementalComponents(UndirectedGraph& graph);
+
+        // Adds the edge to the graph and merges the components of its vertices
+        void addEdgeIdx(VertexIndex vertex1, VertexIndex vertex2, bool force=false);
+        void addEdgeIdx(const Edge& edge, bool force=false) { addEdgeIdx(edge.first, edge.second, force); }
+        // Returns the size of the largest component after each insertion
+        std::vector<size_t> addEdgesIdx(const std::vector<Edge>& edges, bool force=false);
+
+        const UndirectedGraph& getGraph() const { return graph; }
+        VertexIndex findRootIdx(VertexIndex vertex);
+        bool areConnectedIdx(VertexIndex vertex1, VertexIndex vertex2) { return findRootIdx(vertex1) == findRootIdx(vertex2); }
+        size_t getComponentSizeOfIdx(VertexIndex vertex) { return sizes[findRootIdx(vertex)]; }
+        size_t getLargestComponentSize() const { return largestComponentSize; }
+        size_t getComponentNumber() const { return componentNumber; }
+        ComponentLabels getComponentLabels();
+
+    private:
+        UndirectedGraph& graph;
+        std::vector<VertexIndex> parents;
+        // Only valid for the roots
+        std::vector<size_t> sizes;
+        size_t largestComponentSize = 0;
+        size_t componentNumber = 0;
+
+        void addNewVertices();
+        void merge(VertexIndex vertex1, VertexIndex vertex2);
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef BASE_GRAPH_DISTANCE_MATRIX_H
+#define BASE_GRAPH_DISTANCE_MATRIX_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+#include "BaseGraph/undirectedgraph.h"
+#include "BaseGraph/mappedfile.hpp"
+
+
+namespace BaseGraph{
+
+// Distances between every pair of vertices, stored row by row on 8 or 16 bits
+// (Distance is uint8_t or uint16_t). Row i holds d(i, j) for every j. The rows are
+// computed by breadth-first searches split between threadNumber threads (0 uses
+// every hardware thread), each with its own search workspace. std::overflow_error
+// is thrown when a distance does not fit in Distance.
+//
+// When a file name is given, the rows are written in a memory-mapped file instead
+// of memory, so that the matrix can be larger than the memory. The file has a small
+// header followed by the rows and can be mapped again with mapBinaryFile.
+template <typename Distance>
+class DistanceMatrix {
+    public:
+        static const Distance UNREACHABLE = std::numeric_limits<Distance>::max();
+
+        DistanceMatrix(): verticesNumber(0) {}
+        explicit DistanceMatrix(const DirectedGraph& graph, size_t threadNumber=1);
+        explicit DistanceMatrix(const UndirectedGraph& graph, size_t threadNumber=1);
+        DistanceMatrix(const DirectedGraph& graph, const std::string& fileName, size_t threadNumber=1);
+        DistanceMatrix(const UndirectedGraph& graph, const std::string& fileName, size_t threadNumber=1);
+
+        // Returns SIZE_T_MAX when vertex2 cannot be reached from vertex1
+        size_t getDistanceIdx(VertexIndex vertex1, VertexIndex vertex2) const;
+        // Unreachable vertices are UNREACHABLE
+        const Distance* getRowIdx(VertexIndex vertex) const;
+
+        size_t getSize() const { return verticesNumber; }
+        bool isMapped() const { return mapping.isOpen(); }
+
+        void writeInBinaryFile(const std::string& fileName) const;
+        // Maps the file read-only
+        void mapBinaryFile(const std::string& fileName);
+
+    private:
+        struct Header {
+            char tag[16];
+            uint64_t verticesNumber;
+            uint64_t distanceSize;
+        };
+
+        size_t verticesNumber;
+        std::vector<Distance> distances;
+        MappedFile mapping;
+
+        const Distance* getData() const {
+            return mapping.isOpen() ? (const Distance*) ((const char*) mapping.getData() + sizeof(Header)) : distances.data(); }
+        template <typename T>
+        void computeRows(const T& graph, Distance* rows, size_t threadNumber);
+        template <typename T>
+        void computeRowsInFile(const T& graph, const std::string& fileName, size_t threadNumber);
+        Header getHeader() const;
+        void assertVertexInRange(VertexIndex vertex) const;
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef BASE_GRAPH_DISTANCE_ORACLE_H
+#define BASE_GRAPH_DISTANCE_ORACLE_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+#include "BaseGraph/undirectedgraph.h"
+
+
+namespace BaseGraph{
+
+// Bounds on the distance between any two vertices from the distances between every
+// vertex and a few landmarks. For a landmark L, the triangle inequality gives
+//     d(u,L) - d(v,L) <= d(u,v) <= d(u,L) + d(L,v)
+// and the bounds are the tightest over the landmarks. The distances of a vertex to
+// every landmark are contiguous, so that a query reads two arrays of size k.
+//
+// The oracle does not refer to the graph once built: it must be rebuilt when the
+// graph changes.
+class LandmarkDistanceOracle {
+    public:
+        enum LandmarkSelection {
+            HIGHEST_DEGREE, // The landmarks are searched in parallel
+            FARTHEST_POINT  // Each landmark is the vertex farthest from the previous ones
+        };
+
+        LandmarkDistanceOracle(): verticesNumber(0), directed(false) {}
+        LandmarkDistanceOracle(const DirectedGraph& graph, size_t landmarkNumber,
+                LandmarkSelection selection=HIGHEST_DEGREE, size_t threadNumber=1);
+        LandmarkDistanceOracle(const UndirectedGraph& graph, size_t landmarkNumber,
+                LandmarkSelection selection=HIGHEST_DEGREE, size_t threadNumber=1);
+
+        // SIZE_T_MAX stands for an infinite distance. The upper bound is infinite when
+        // no landmark reaches v from u, even if v is reachable from u.
+        std::pair<size_t, size_t> getDistanceBoundsIdx(VertexIndex vertex1, VertexIndex vertex2) const;
+        size_t getLowerBoundIdx(VertexIndex vertex1, VertexIndex vertex2) const { return getDistanceBoundsIdx(vertex1, vertex2).first; }
+        size_t getUpperBoundIdx(VertexIndex vertex1, VertexIndex vertex2) const { return getDistanceBoundsIdx(vertex1, vertex2).second; }
+
+        const std::vector<VertexIndex>& getLandmarks() const { return landmarks; }
+        size_t getSize() const { return verticesNumber; }
+        bool isDirected() const { return directed; }
+
+        void writeInBinaryStream(std::ostream& stream) const;
+        void loadFromBinaryStream(std::istream& stream);
+        void writeInBinaryFile(const std::string& fileName) const;
+        void loadFromBinaryFile(const std::string& fileName);
+
+    private:
+        static const uint32_t UNREACHABLE = UINT32_MAX;
+
+        size_t verticesNumber;
+        bool directed;
+        std::vector<VertexIndex> landmarks;
+        // fromLandmarks[v*k+i] is d(landmark i, v) and toLandmarks[v*k+i] is d(v, landmark i).
+        // toLandmarks is empty for undirected graphs.
+        std::vector<uint32_t> fromLandmarks, toLandmarks;
+
+        template <typename T>
+        void build(const T& graph, size_t landmarkNumber, LandmarkSelection selection, size_t threadNumber);
+        void assertVertexInRange(VertexIndex vertex) const;
+};
+
+} // namespace BaseGraph
+
+#endif
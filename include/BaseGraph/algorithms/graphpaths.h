@@ -4,14 +4,15 @@
 #include <vector>
 #include <list>
 #include <limits>
+#include <memory>
+#include <stdexcept>
 
 #include "BaseGraph/directedgraph.h"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
 
 
 namespace BaseGraph{
 
-const size_t SIZE_T_MAX = std::numeric_limits<size_t>::max();
-
 typedef std::pair<std::vector<size_t>, std::vector<VertexIndex>> Predecessors;
 typedef std::pair<std::vector<size_t>, std::vector<std::list<VertexIndex>>> MultiplePredecessors;
 typedef std::list<VertexIndex> Path;
@@ -19,11 +20,21 @@ typedef std::list<std::list<VertexIndex>> MultiplePaths;
 
 
 
+// Bidirectional search. For DirectedGraph, the backward search follows the in edges,
+// which are built in contiguous arrays unless given (see DirectedGraph::getInEdges).
+// Many queries should share a workspace (see BreadthFirstSearch::runBidirectional),
+// which builds the in edges once and only resets the vertices reached by the last query.
 template <typename T> Path findGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+Path findGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, const AdjacencyLists& inEdges);
 template <typename T> MultiplePaths findAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
 template <typename T> std::vector<Path> findGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx);
 template <typename T> std::vector<MultiplePaths> findAllGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx);
 
+// Overloads reusing the buffers of a workspace created for the same graph. The
+// geodesic between two vertices is found by a bidirectional search.
+template <typename T> Path findGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, BreadthFirstSearch<T>& workspace);
+template <typename T> std::vector<Path> findGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx, BreadthFirstSearch<T>& workspace);
+
 
 template <typename T> Predecessors findPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx);
 template <typename T> Path findPathToVertexFromPredecessorsIdx(
@@ -35,6 +46,33 @@ template <typename T> std::vector<size_t> findShortestPathLengthsFromVertexIdx(c
     return findPredecessorsOfVertexIdx(graph, sourceIdx).first;
 }
 
+template <typename T> Predecessors findPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx, BreadthFirstSearch<T>& workspace);
+// The returned reference is overwritten by the next use of the workspace
+template <typename T> const std::vector<size_t>& findShortestPathLengthsFromVertexIdx(
+        const T& graph, VertexIndex sourceIdx, BreadthFirstSearch<T>& workspace) {
+    if (&workspace.getGraph() != &graph)
+        throw std::invalid_argument("The workspace was created for another graph.");
+    workspace.run(sourceIdx);
+    return workspace.getDistances();
+}
+
+
+// Shortest-path DAG of a source stored in contiguous arrays. The predecessors of a
+// vertex v are predecessors[offsets[v]] to predecessors[offsets[v+1]-1], in the
+// order they were reached. Unreachable vertices are at distance SIZE_T_MAX.
+struct PredecessorDAG {
+    VertexIndex source;
+    std::vector<size_t> distances;
+    std::vector<size_t> offsets;
+    std::vector<VertexIndex> predecessors;
+
+    size_t getPredecessorNumber(VertexIndex vertex) const { return offsets[vertex+1]-offsets[vertex]; }
+    const VertexIndex* beginPredecessors(VertexIndex vertex) const { return predecessors.data()+offsets[vertex]; }
+    const VertexIndex* endPredecessors(VertexIndex vertex) const { return predecessors.data()+offsets[vertex+1]; }
+};
+
+template <typename T> PredecessorDAG findPredecessorDAGOfVertexIdx(const T& graph, VertexIndex vertexIdx);
+MultiplePaths findMultiplePathsToVertexFromPredecessorDAGIdx(const PredecessorDAG& predecessorDAG, VertexIndex destinationIdx);
 
 template <typename T> MultiplePredecessors findAllPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx);
 template <typename T> MultiplePaths findMultiplePathsToVertexFromPredecessorsIdx(
@@ -42,6 +80,41 @@ template <typename T> MultiplePaths findMultiplePathsToVertexFromPredecessorsIdx
 template <typename T> MultiplePaths findMultiplePathsToVertexFromPredecessorsIdx(
         const T& graph, VertexIndex destinationIdx, const MultiplePredecessors& distancesPredecessors);
 
+
+// Enumerates the geodesics found by findAllGeodesicsIdx one at a time, in the same
+// order. Only the current geodesic and its position in the predecessors are kept
+// on top of the predecessor DAG, which can be shared by many generators.
+class GeodesicGenerator {
+    public:
+        GeodesicGenerator(std::shared_ptr<const PredecessorDAG> predecessorDAG, VertexIndex destinationIdx);
+        // Borrows the DAG, which must outlive the generator
+        GeodesicGenerator(const PredecessorDAG& predecessorDAG, VertexIndex destinationIdx);
+
+        // Moves to the next geodesic. Returns false when every geodesic was generated.
+        bool next();
+        // Vertices of the current geodesic, from the source to the destination
+        const std::vector<VertexIndex>& getGeodesic() const { return geodesic; }
+
+    private:
+        // Null when the DAG is borrowed
+        std::shared_ptr<const PredecessorDAG> ownedPredecessorDAG;
+        const PredecessorDAG* predecessorDAG;
+        std::vector<VertexIndex> geodesic;
+        // geodesic[i] is predecessorDAG->predecessors[positions[i]]
+        std::vector<size_t> positions;
+        bool started = false;
+        bool finished = false;
+
+        void start(VertexIndex destinationIdx);
+        void takeLastPredecessors(size_t levelsNumber);
+};
+template <typename T> GeodesicGenerator generateAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+
+// Number of geodesics found by findAllGeodesicsIdx, counted without enumerating them.
+// Throws overflow_error when the number does not fit in a size_t.
+template <typename T> size_t countAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+template <typename T> std::vector<size_t> countAllGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx);
+
 } // namespace BaseGraph
 
 #endif
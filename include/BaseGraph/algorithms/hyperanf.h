@@ -0,0 +1,44 @@
+#ifndef BASE_GRAPH_HYPERANF_H
+#define BASE_GRAPH_HYPERANF_H
+
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+#include "BaseGraph/undirectedgraph.h"
+
+
+namespace BaseGraph{
+
+// Estimates returned by estimateNeighbourhoodFunction. pairNumbers[t] estimates the
+// number of pairs (u, v) such that d(u,v) <= t, including the pairs (v, v). The
+// last value is the number of reachable pairs.
+struct NeighbourhoodFunction {
+    std::vector<double> pairNumbers;
+    // Sum over the vertices v reachable from u of 1/d(u,v)
+    std::vector<double> harmonicCentralities;
+
+    // Fraction of the reachable pairs of distinct vertices that are at distance t
+    std::vector<double> getDistanceDistribution() const;
+    double getAverageDistance() const;
+    // Smallest distance, interpolated between integers, within which a fraction of
+    // the reachable pairs of distinct vertices lie
+    double getEffectiveDiameter(double fraction=0.9) const;
+};
+
+// Approximate neighbourhood function by HyperANF (Boldi, Rosa and Vigna, 2011). Every
+// vertex keeps a HyperLogLog counter of the vertices it reaches within t steps. At
+// step t+1, the counter of a vertex becomes the union of its counter and of the
+// counters of its out neighbours that changed at step t, so that a step reads each
+// edge at most once. The union of two counters is the registerwise maximum of
+// contiguous bytes, which compilers vectorize.
+//
+// The relative standard error of each counter is about 1.04/sqrt(2^log2RegisterNumber)
+// and the counters use n*2^(log2RegisterNumber+1) bytes. The vertices are hashed with
+// a seed drawn from rng. The vertices are split between threadNumber threads (0 uses
+// every hardware thread).
+template <typename T>
+NeighbourhoodFunction estimateNeighbourhoodFunction(const T& graph, size_t log2RegisterNumber=7, size_t threadNumber=1);
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef BASE_GRAPH_MULTI_SOURCE_BFS_HPP
+#define BASE_GRAPH_MULTI_SOURCE_BFS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BaseGraph/types.h"
+
+
+namespace BaseGraph{
+
+inline size_t countTrailingZeros(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    size_t zeros = 0;
+    while (((mask >> zeros) & 1) == 0)
+        zeros++;
+    return zeros;
+#endif
+}
+
+// Bit masks of the searches, one per vertex. A workspace can be reused by successive
+// calls on graphs of the same size to avoid allocating them every time, but must not
+// be shared by concurrent calls.
+struct MultiSourceBFSWorkspace {
+    std::vector<uint64_t> seen, visit, visitNext;
+
+    void reset(size_t verticesNumber) {
+        seen.assign(verticesNumber, 0);
+        visit.assign(verticesNumber, 0);
+        visitNext.assign(verticesNumber, 0);
+    }
+};
+
+// Multi-source breadth-first search (Then et al., 2014). Up to 64 searches advance
+// together: every vertex holds a 64 bits mask of the searches that reached it, so
+// the adjacency list of a vertex is read once per level for all the searches.
+//
+// callback(source, vertex, distance) is called once for every vertex reachable from
+// each source, including the source itself at distance 0. Sources are processed by
+// batches of 64, and within a batch the calls are made by increasing distance.
+template <typename T, typename Callback>
+void multiSourceBreadthFirstSearch(const T& graph, const std::vector<VertexIndex>& sources, Callback callback,
+        MultiSourceBFSWorkspace& workspace) {
+    const size_t BATCH_SIZE = 64;
+    size_t verticesNumber = graph.getSize();
+
+    std::vector<uint64_t>& seen = workspace.seen;
+    std::vector<uint64_t>& visit = workspace.visit;
+    std::vector<uint64_t>& visitNext = workspace.visitNext;
+
+    for (size_t batchBegin=0; batchBegin<sources.size(); batchBegin+=BATCH_SIZE) {
+        size_t batchSize = sources.size()-batchBegin < BATCH_SIZE ? sources.size()-batchBegin : BATCH_SIZE;
+        const VertexIndex* batchSources = &sources[batchBegin];
+
+        // visitNext is also cleared in case a previous search was interrupted
+        workspace.reset(verticesNumber);
+        for (size_t i=0; i<batchSize; i++) {
+            seen[batchSources[i]] |= uint64_t(1) << i;
+            visit[batchSources[i]] |= uint64_t(1) << i;
+            callback(batchSources[i], batchSources[i], 0);
+        }
+
+        bool searchesActive = true;
+        for (size_t distance=1; searchesActive; distance++) {
+            for (VertexIndex vertex=0; vertex<verticesNumber; vertex++) {
+                if (visit[vertex] == 0)
+                    continue;
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    visitNext[neighbour] |= visit[vertex] & ~seen[neighbour];
+            }
+
+            searchesActive = false;
+            for (VertexIndex vertex=0; vertex<verticesNumber; vertex++) {
+                uint64_t newSearches = visitNext[vertex];
+                visit[vertex] = newSearches;
+                if (newSearches == 0)
+                    continue;
+
+                searchesActive = true;
+                visitNext[vertex] = 0;
+                seen[vertex] |= newSearches;
+                while (newSearches != 0) {
+                    callback(batchSources[countTrailingZeros(newSearches)], vertex, distance);
+                    newSearches &= newSearches-1;
+                }
+            }
+        }
+    }
+}
+
+template <typename T, typename Callback>
+void multiSourceBreadthFirstSearch(const T& graph, const std::vector<VertexIndex>& sources, Callback callback) {
+    MultiSourceBFSWorkspace workspace;
+    multiSourceBreadthFirstSearch(graph, sources, callback, workspace);
+}
+
+// Runs the search from every vertex of the graph.
+template <typename T, typename Callback>
+void multiSourceBreadthFirstSearch(const T& graph, Callback callback) {
+    std::vector<VertexIndex> sources;
+    sources.reserve(graph.getSize());
+    for (VertexIndex vertex: graph)
+        sources.push_back(vertex);
+    multiSourceBreadthFirstSearch(graph, sources, callback);
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef BASE_GRAPH_PRUNED_LANDMARK_LABELING_H
+#define BASE_GRAPH_PRUNED_LANDMARK_LABELING_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BaseGraph/directedgraph.h"
+#include "BaseGraph/mappedfile.hpp"
+#include "BaseGraph/undirectedgraph.h"
+
+
+namespace BaseGraph{
+
+// Exact distance index by pruned landmark labeling (Akiba, Iwata and Yoshida, 2013).
+// Every vertex stores a label of (hub, distance) pairs such that each pair of
+// vertices shares a hub on one of its shortest paths (2-hop cover). A query merges
+// the two labels sorted by hub. The hubs are ranked by decreasing degree and a
+// breadth-first search from each hub is pruned where the labels found so far already
+// give the distance.
+//
+// For an UndirectedGraph, the first roots use bit-parallel labels: the search from a
+// root also encodes the distances to 64 of its neighbours in two bit sets per vertex.
+// For a DirectedGraph, each vertex has a label of hubs reaching it and a label of hubs
+// it reaches.
+//
+// The index is stored in a single buffer laid out like its file, so that a written
+// index can be memory-mapped by query processes. Distances are stored on 16 bits.
+class PrunedLandmarkLabeling {
+    public:
+        static const size_t DEFAULT_BIT_PARALLEL_ROOTS = 16;
+
+        PrunedLandmarkLabeling() { setPointers(); }
+        explicit PrunedLandmarkLabeling(const UndirectedGraph& graph, size_t bitParallelRootNumber=DEFAULT_BIT_PARALLEL_ROOTS);
+        explicit PrunedLandmarkLabeling(const DirectedGraph& graph);
+        PrunedLandmarkLabeling(PrunedLandmarkLabeling&& other) { setPointers(); swap(other); }
+        PrunedLandmarkLabeling& operator=(PrunedLandmarkLabeling&& other) { swap(other); return *this; }
+        PrunedLandmarkLabeling(const PrunedLandmarkLabeling&) = delete;
+        PrunedLandmarkLabeling& operator=(const PrunedLandmarkLabeling&) = delete;
+
+        // Returns SIZE_T_MAX when vertex2 cannot be reached from vertex1
+        size_t getDistanceIdx(VertexIndex vertex1, VertexIndex vertex2) const;
+
+        size_t getSize() const { return header->verticesNumber; }
+        bool isDirected() const { return header->directed; }
+        bool isMapped() const { return mapping.isOpen(); }
+        size_t getBitParallelRootNumber() const { return header->bitParallelRootNumber; }
+        // Number of (hub, distance) pairs, without the bit-parallel labels
+        size_t getLabelEntryNumber() const;
+
+        void writeInBinaryFile(const std::string& fileName) const;
+        // Reads the file in memory. Both loading and mapping read the whole file once to
+        // check that the ranks and labels are valid.
+        void loadFromBinaryFile(const std::string& fileName);
+        // Maps the file read-only. The index reads the file until it is destroyed or loaded again.
+        void mapBinaryFile(const std::string& fileName);
+
+        void swap(PrunedLandmarkLabeling& other);
+
+    private:
+        struct Header {
+            char tag[16];
+            uint64_t verticesNumber;
+            uint64_t directed;
+            uint64_t bitParallelRootNumber;
+            uint64_t inEntryNumber;
+            uint64_t outEntryNumber;
+        };
+        struct Labels {
+            const uint64_t* offsets;
+            const uint32_t* hubs;
+            const uint16_t* distances;
+        };
+
+        std::vector<uint64_t> buffer;
+        MappedFile mapping;
+
+        const Header* header;
+        const uint32_t* vertexRanks;
+        Labels inLabels, outLabels;
+        const uint64_t* bitParallelSets;
+        const uint16_t* bitParallelDistances;
+
+        void setPointers();
+        void setPointers(const char* data, size_t size);
+        void validateContent() const;
+        void assertVertexInRange(VertexIndex vertex) const;
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef BASE_GRAPH_TRIANGLES_H
+#define BASE_GRAPH_TRIANGLES_H
+
+#include <array>
+#include <list>
+#include <vector>
+
+#include "BaseGraph/undirectedgraph.h"
+
+
+namespace BaseGraph{
+
+struct TriangleCounts {
+    size_t triangleNumber = 0;
+    // Number of triangles that contain each vertex
+    std::vector<size_t> vertexTriangleNumbers;
+};
+
+// Triangles of an undirected graph enumerated once each. Every edge is oriented from
+// the vertex of lower degree to the vertex of higher degree (ties broken by index),
+// so that no vertex has more than O(sqrt(E)) out neighbours. The triangles of a
+// vertex u are the common out neighbours of u and of each out neighbour v, found by
+// merging their sorted out neighbours, or by galloping through the longer one when
+// the lengths are very different. The enumeration takes O(E^1.5) time.
+//
+// Self-loops and duplicate edges are ignored. The oriented edges are copied, so the
+// graph can be modified afterwards.
+class TriangleEnumerator {
+    public:
+        // Galloping is used when a list is this many times longer than the other
+        static const size_t GALLOPING_RATIO = 32;
+
+        explicit TriangleEnumerator(const UndirectedGraph& graph);
+
+        // Total and per-vertex counts in a single enumeration. The vertices are split
+        // between threadNumber threads (0 uses every hardware thread).
+        TriangleCounts countTriangles(size_t threadNumber=1) const;
+        // Triangles with increasing vertices, in lexicographic order
+        std::list<std::array<VertexIndex, 3>> findAllTriangles() const;
+
+    private:
+        size_t verticesNumber;
+        std::vector<size_t> outOffsets;
+        // Out neighbours of each vertex sorted by index
+        std::vector<VertexIndex> outNeighbours;
+
+        template <typename Function>
+        void forEachTriangleOfVertexIdx(VertexIndex vertex, Function function) const;
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef BASE_GRAPH_BINARY_STREAM_HPP
+#define BASE_GRAPH_BINARY_STREAM_HPP
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+
+
+namespace BaseGraph{
+
+// Number of bytes between the read position and the end of the stream, used to
+// reject counts read from a corrupted stream before allocating for them. Streams
+// that cannot seek return the maximum value, so that only the reads can fail.
+inline uint64_t getRemainingStreamSize(std::istream& stream) {
+    std::streampos position = stream.tellg();
+    if (position == std::streampos(-1))
+        return std::numeric_limits<uint64_t>::max();
+    stream.seekg(0, std::ios::end);
+    std::streampos end = stream.tellg();
+    stream.seekg(position);
+    if (end == std::streampos(-1) || !stream)
+        return std::numeric_limits<uint64_t>::max();
+    return uint64_t(end-position);
+}
+
+// Whether count elements of elementSize bytes fit in the remaining bytes, without
+// overflowing the product
+inline bool fitsInRemainingSize(uint64_t count, uint64_t elementSize, uint64_t remainingSize) {
+    return elementSize == 0 || count <= remainingSize/elementSize;
+}
+
+} // namespace BaseGraph
+
+#endif
@@ -24,19 +24,19 @@ void writeEdgeListIdxInTextFile(const UndirectedGraph& graph, std::ofstream& fil
 void writeEdgeListIdxInBinaryFile(const UndirectedGraph& graph, const std::string& fileName);
 void writeEdgeListIdxInBinaryFile(const UndirectedGraph& graph, std::ofstream& fileStream);
 
-template<typename Label, bool hashable=false> void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName);
-template<typename Label, bool hashable=false> void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream);
-template<typename Label, bool hashable=false> void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize=0);
 
-template<typename Label, bool hashable=false> void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName);
-template<typename Label, bool hashable=false> void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream);
-template<typename Label, bool hashable=false> void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize=0);
 
 
 DirectedGraph loadDirectedEdgeListIdxFromTextFile(const std::string& fileName);
@@ -51,38 +51,43 @@ UndirectedGraph loadUndirectedEdgeListIdxFromBinaryFile(std::ifstream& fileStrea
 
 VertexLabeledUndirectedGraph<std::string, true> loadUndirectedEdgeListFromTextFile(const std::string& fileName);
 VertexLabeledUndirectedGraph<std::string, true> loadUndirectedEdgeListFromTextFile(std::ifstream& fileStream);
-template<typename Label, bool hashable=false> VertexLabeledUndirectedGraph<Label, hashable> loadUndirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> VertexLabeledUndirectedGraph<Label, hashable> loadUndirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize=0);
-template<typename Label, bool hashable=false> void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ifstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> VertexLabeledUndirectedGraph<Label, hashable, LabelHash> loadUndirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> VertexLabeledUndirectedGraph<Label, hashable, LabelHash> loadUndirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ifstream& fileStream, size_t byteSize=0);
 
 VertexLabeledDirectedGraph<std::string, true> loadDirectedEdgeListFromTextFile(const std::string& fileName);
 VertexLabeledDirectedGraph<std::string, true> loadDirectedEdgeListFromTextFile(std::ifstream& fileStream);
-template<typename Label, bool hashable=false> VertexLabeledDirectedGraph<Label, hashable> loadDirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> VertexLabeledDirectedGraph<Label, hashable> loadDirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize=0);
-template<typename Label, bool hashable=false> void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize=0);
-template<typename Label, bool hashable=false> void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable>& graph, std::ifstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> VertexLabeledDirectedGraph<Label, hashable, LabelHash> loadDirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> VertexLabeledDirectedGraph<Label, hashable, LabelHash> loadDirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize=0);
+template<typename Label, bool hashable=false, typename LabelHash=std::hash<Label>> void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ifstream& fileStream, size_t byteSize=0);
+
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash> void writeFrozenLabelIndexInBinaryFile(const VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, const std::string& fileName);
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash> void writeFrozenLabelIndexInBinaryFile(const VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, std::ofstream& fileStream);
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash> void loadFrozenLabelIndexFromBinaryFile(VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, const std::string& fileName);
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash> void loadFrozenLabelIndexFromBinaryFile(VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, std::ifstream& fileStream);
 
 
 
 
 // VertexLabeledDirectedGraph
 
-template<typename Label, bool hashable>
-VertexLabeledDirectedGraph<Label, hashable> loadDirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize){
-    VertexLabeledDirectedGraph<Label, hashable> returnedGraph;
+template<typename Label, bool hashable, typename LabelHash>
+VertexLabeledDirectedGraph<Label, hashable, LabelHash> loadDirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize){
+    VertexLabeledDirectedGraph<Label, hashable, LabelHash> returnedGraph;
 
     std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
-    returnedGraph = loadDirectedEdgeListFromBinaryFile<Label, hashable>(fileStream, byteSize);
+    returnedGraph = loadDirectedEdgeListFromBinaryFile<Label, hashable, LabelHash>(fileStream, byteSize);
     fileStream.close();
 
     return returnedGraph;
 }
 
-template<typename Label, bool hashable>
-VertexLabeledDirectedGraph<Label, hashable> loadDirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+VertexLabeledDirectedGraph<Label, hashable, LabelHash> loadDirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to read binary file");
-    VertexLabeledDirectedGraph<Label, hashable> returnedGraph;
+    VertexLabeledDirectedGraph<Label, hashable, LabelHash> returnedGraph;
     if (byteSize == 0) byteSize = sizeof(Label);
 
     if(!fileStream.is_open())
@@ -100,15 +105,15 @@ VertexLabeledDirectedGraph<Label, hashable> loadDirectedEdgeListFromBinaryFile(s
     return returnedGraph;
 }
 
-template<typename Label, bool hashable>
-void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ifstream fileStream(fileName.c_str(), std::ios::binary);
     addVerticesFromBinaryFile(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable>& graph, std::ifstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ifstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to read binary file");
 
     if (byteSize == 0) byteSize = sizeof(Label);
@@ -122,21 +127,21 @@ void addVerticesFromBinaryFile(VertexLabeledDirectedGraph<Label, hashable>& grap
     }
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName){
     std::ofstream fileStream(fileName.c_str());
     writeEdgeListInTextFile(graph, fileStream);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream){
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getOutEdgesOfIdx(i))
             fileStream << vertices[i] << "   " << vertices[j] << '\n';
@@ -149,7 +154,7 @@ inline void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<unsigned ch
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getOutEdgesOfIdx(i))
             // Cast to int because operator << does not output properly otherwise
@@ -163,22 +168,22 @@ inline void writeEdgeListInTextFile(const VertexLabeledDirectedGraph<signed char
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getOutEdgesOfIdx(i))
             // Cast to int because operator << does not output properly otherwise
             fileStream << (unsigned long int) vertices[i] << "   " << (unsigned long int) vertices[j] << '\n';
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ofstream fileStream(fileName.c_str(), std::ios::out | std::ios::binary);
     writeEdgeListInBinaryFile(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to write binary file");
 
     if (byteSize == 0) byteSize = sizeof(Label);
@@ -186,7 +191,7 @@ void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph) {
         for (const VertexIndex& j: graph.getOutEdgesOfIdx(i)) {
             fileStream.write((char*) &vertices[i], byteSize);
@@ -195,22 +200,22 @@ void writeEdgeListInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>
     }
 }
 
-template<typename Label, bool hashable>
-void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ofstream fileStream(fileName, std::ios::binary);
     writeVerticesInBinaryFile(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to write binary file");
     if (byteSize == 0) byteSize = sizeof(Label);
 
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (auto& vertex: vertices)
         fileStream.write((char*) &vertex, byteSize);
 }
@@ -218,21 +223,21 @@ void writeVerticesInBinaryFile(const VertexLabeledDirectedGraph<Label, hashable>
 
 // VertexLabeledUndirectedGraph
 
-template<typename Label, bool hashable>
-VertexLabeledUndirectedGraph<Label, hashable> loadUndirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize){
-    VertexLabeledUndirectedGraph<Label, hashable> returnedGraph;
+template<typename Label, bool hashable, typename LabelHash>
+VertexLabeledUndirectedGraph<Label, hashable, LabelHash> loadUndirectedEdgeListFromBinaryFile(const std::string& fileName, size_t byteSize){
+    VertexLabeledUndirectedGraph<Label, hashable, LabelHash> returnedGraph;
 
     std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
-    returnedGraph = loadUndirectedEdgeListFromBinaryFile<Label>(fileStream, byteSize);
+    returnedGraph = loadUndirectedEdgeListFromBinaryFile<Label, hashable, LabelHash>(fileStream, byteSize);
     fileStream.close();
 
     return returnedGraph;
 }
 
-template<typename Label, bool hashable>
-VertexLabeledUndirectedGraph<Label, hashable> loadUndirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+VertexLabeledUndirectedGraph<Label, hashable, LabelHash> loadUndirectedEdgeListFromBinaryFile(std::ifstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to read binary file");
-    VertexLabeledUndirectedGraph<Label, hashable> returnedGraph;
+    VertexLabeledUndirectedGraph<Label, hashable, LabelHash> returnedGraph;
     if (byteSize == 0) byteSize = sizeof(Label);
 
     if(!fileStream.is_open())
@@ -250,15 +255,15 @@ VertexLabeledUndirectedGraph<Label, hashable> loadUndirectedEdgeListFromBinaryFi
     return returnedGraph;
 }
 
-template<typename Label, bool hashable>
-void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ifstream fileStream(fileName.c_str(), std::ios::binary);
     addVerticesFromBinaryFile<Label>(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ifstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ifstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to read binary file");
     if (byteSize == 0) byteSize = sizeof(Label);
 
@@ -271,21 +276,21 @@ void addVerticesFromBinaryFile(VertexLabeledUndirectedGraph<Label, hashable>& gr
     }
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName){
     std::ofstream fileStream(fileName.c_str());
     writeEdgeListInTextFile(graph, fileStream);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream){
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getNeighboursOfIdx(i))
             if (i<j) fileStream << vertices[i] << "   " << vertices[j] << '\n';
@@ -298,7 +303,7 @@ inline void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<unsigned
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getNeighboursOfIdx(i))
             // Cast to int because operator << does not output properly otherwise
@@ -312,29 +317,29 @@ inline void writeEdgeListInTextFile(const VertexLabeledUndirectedGraph<signed ch
 
     fileStream << "# Vertex1,  Vertex2\n";
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         for (const VertexIndex& j: graph.getNeighboursOfIdx(i))
             // Cast to int because operator << does not output properly otherwise
             if (i<j) fileStream << (unsigned long int) vertices[i] << "   " << (unsigned long int) vertices[j] << '\n';
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ofstream fileStream(fileName.c_str(), std::ios::out | std::ios::binary);
     writeEdgeListInBinaryFile(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize) {
+template<typename Label, bool hashable, typename LabelHash>
+void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize) {
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to write binary file");
     if (byteSize == 0) byteSize = sizeof(Label);
 
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph) {
         for (const VertexIndex& j: graph.getNeighboursOfIdx(i)) {
             if (i <= j) { // write edges once
@@ -345,27 +350,65 @@ void writeEdgeListInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashabl
     }
 }
 
-template<typename Label, bool hashable>
-void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, const std::string& fileName, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, const std::string& fileName, size_t byteSize){
     std::ofstream fileStream(fileName, std::ios::binary);
     writeVerticesInBinaryFile(graph, fileStream, byteSize);
     fileStream.close();
 }
 
-template<typename Label, bool hashable>
-void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable>& graph, std::ofstream& fileStream, size_t byteSize){
+template<typename Label, bool hashable, typename LabelHash>
+void writeVerticesInBinaryFile(const VertexLabeledUndirectedGraph<Label, hashable, LabelHash>& graph, std::ofstream& fileStream, size_t byteSize){
     static_assert(!std::is_same<Label, std::string>::value, "No implementation of string to write binary file");
     if (byteSize == 0) byteSize = sizeof(Label);
 
     if(!fileStream.is_open())
         throw std::runtime_error("Could not open file.");
 
-    auto& vertices = graph.getVertices();
+    auto& vertices = graph.getVertexLabels();
     for (const VertexIndex& i: graph)
         fileStream.write((char*) &vertices[i], byteSize);
 }
 
 
+// Frozen label index
+
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash>
+void writeFrozenLabelIndexInBinaryFile(const VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, const std::string& fileName){
+    std::ofstream fileStream(fileName, std::ios::binary);
+    writeFrozenLabelIndexInBinaryFile(graph, fileStream);
+    fileStream.close();
+}
+
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash>
+void writeFrozenLabelIndexInBinaryFile(const VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, std::ofstream& fileStream){
+    if (!graph.isFrozen())
+        throw std::logic_error("Only the index of a frozen graph can be written.");
+    if(!fileStream.is_open())
+        throw std::runtime_error("Could not open file.");
+
+    graph.getFrozenIndex().writeInBinaryStream(fileStream);
+}
+
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash>
+void loadFrozenLabelIndexFromBinaryFile(VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, const std::string& fileName){
+    std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
+    loadFrozenLabelIndexFromBinaryFile(graph, fileStream);
+    fileStream.close();
+}
+
+// Freezes the graph with the index of the file, which must have been written for the same labels
+template<typename GraphBase, typename Label, bool hashable, typename LabelHash>
+void loadFrozenLabelIndexFromBinaryFile(VertexLabeledGraph<GraphBase, Label, hashable, LabelHash>& graph, std::ifstream& fileStream){
+    if(!fileStream.is_open())
+        throw std::runtime_error("Could not open file.");
+
+    PerfectHashIndex index;
+    index.loadFromBinaryStream(fileStream, graph.getSize());
+    graph.freeze(index);
+}
+
+
 } // namespace BaseGraph
 
 
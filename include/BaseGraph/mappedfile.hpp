@@ -0,0 +1,120 @@
+#ifndef BASE_GRAPH_MAPPED_FILE_HPP
+#define BASE_GRAPH_MAPPED_FILE_HPP
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BASE_GRAPH_HAS_MMAP
+#endif
+
+
+namespace BaseGraph{
+
+// File mapped in memory with POSIX mmap. The mapping is released when the object
+// is destroyed. Mapping throws std::runtime_error on platforms without mmap.
+class MappedFile {
+    public:
+        MappedFile() {}
+        MappedFile(MappedFile&& other) { swap(other); }
+        MappedFile& operator=(MappedFile&& other) { swap(other); return *this; }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile() { close(); }
+
+        static bool isSupported() {
+#ifdef BASE_GRAPH_HAS_MMAP
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        // Maps an existing file read-only
+        static MappedFile openReadOnly(const std::string& fileName) {
+            MappedFile mappedFile;
+#ifdef BASE_GRAPH_HAS_MMAP
+            int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+            if (fileDescriptor == -1)
+                throw std::runtime_error("Could not open file.");
+            struct stat fileStatus;
+            if (fstat(fileDescriptor, &fileStatus) == -1 || fileStatus.st_size == 0) {
+                ::close(fileDescriptor);
+                throw std::runtime_error("Could not read file.");
+            }
+            mappedFile.map(fileDescriptor, fileStatus.st_size, PROT_READ);
+#else
+            throwUnsupported();
+#endif
+            return mappedFile;
+        }
+
+        // Creates or truncates a file of the given size and maps it read-write. The
+        // pages written are flushed to the file by the system, so the file can be
+        // larger than the memory.
+        static MappedFile create(const std::string& fileName, size_t size) {
+            MappedFile mappedFile;
+#ifdef BASE_GRAPH_HAS_MMAP
+            if (size == 0)
+                throw std::invalid_argument("Cannot map an empty file.");
+            int fileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (fileDescriptor == -1)
+                throw std::runtime_error("Could not open file.");
+            if (ftruncate(fileDescriptor, size) == -1) {
+                ::close(fileDescriptor);
+                throw std::runtime_error("Could not resize file.");
+            }
+            mappedFile.map(fileDescriptor, size, PROT_READ | PROT_WRITE);
+#else
+            throwUnsupported();
+#endif
+            return mappedFile;
+        }
+
+        void* getData() const { return data; }
+        size_t getSize() const { return size; }
+        bool isOpen() const { return data != nullptr; }
+
+        void close() {
+#ifdef BASE_GRAPH_HAS_MMAP
+            if (data != nullptr)
+                munmap(data, size);
+#endif
+            data = nullptr;
+            size = 0;
+        }
+
+        void swap(MappedFile& other) {
+            std::swap(data, other.data);
+            std::swap(size, other.size);
+        }
+
+    private:
+        void* data = nullptr;
+        size_t size = 0;
+
+#ifdef BASE_GRAPH_HAS_MMAP
+        // Closes the file descriptor, which the mapping does not need
+        void map(int fileDescriptor, size_t fileSize, int protection) {
+            void* mapping = mmap(nullptr, fileSize, protection, MAP_SHARED, fileDescriptor, 0);
+            ::close(fileDescriptor);
+            if (mapping == MAP_FAILED)
+                throw std::runtime_error("Could not map file.");
+            data = mapping;
+            size = fileSize;
+        }
+#else
+        static void throwUnsupported() {
+            throw std::runtime_error("Memory-mapped files are not supported on this platform.");
+        }
+#endif
+};
+
+} // namespace BaseGraph
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <list>
+#include <map>
+#include <unordered_map>
 
 #include "BaseGraph/directedgraph.h"
 
@@ -12,9 +14,50 @@ namespace BaseGraph{
 typedef std::list<VertexIndex> Component;
 
 
+enum ShortestPathMetric {
+    CLOSENESS_CENTRALITIES = 1,
+    HARMONIC_CENTRALITIES = 2,
+    SHORTEST_PATH_AVERAGES = 4,
+    SHORTEST_PATH_HARMONIC_AVERAGES = 8,
+    ECCENTRICITIES = 16,
+    SHORTEST_PATHS_DISTRIBUTION = 32,
+    ALL_SHORTEST_PATH_METRICS = 63
+};
+
+// Metrics returned by getShortestPathMetrics. The metrics that were not requested are empty.
+struct ShortestPathMetrics {
+    std::vector<double> closenessCentralities;
+    std::vector<double> harmonicCentralities;
+    std::vector<double> shortestPathAverages;
+    std::vector<double> shortestPathHarmonicAverages;
+    std::vector<size_t> eccentricities;
+    std::vector<std::unordered_map<size_t, double> > shortestPathsDistribution;
+};
+
+// Computes the requested metrics (ShortestPathMetric values combined with |) from a
+// single search from every vertex. Batches of sources are handed dynamically to
+// threadNumber threads (0 uses every hardware thread). The other shortest path
+// metrics below use this function with getThreadNumber() threads.
+template <typename T> ShortestPathMetrics getShortestPathMetrics(const T& graph,
+        unsigned int metrics=ALL_SHORTEST_PATH_METRICS, size_t threadNumber=1);
+
 template <typename T> std::vector<double> getClosenessCentralities(const T& graph);
 template <typename T> std::vector<double> getHarmonicCentralities(const T& graph);
-template <typename T> std::vector<double> getBetweennessCentralities(const T& graph, bool normalizeWithGeodesicNumber=true);
+// The sources are split between threadNumber threads (0 uses every hardware thread).
+// Only the geodesics starting from the given sources are counted: the results of
+// disjoint sets of sources add up to the result for their union.
+template <typename T> std::vector<double> getBetweennessCentralities(const T& graph, bool normalizeWithGeodesicNumber=true, size_t threadNumber=1);
+template <typename T> std::vector<double> getBetweennessCentralities(const T& graph, const std::vector<VertexIndex>& sources,
+        bool normalizeWithGeodesicNumber=true, size_t threadNumber=1);
+// Estimates getBetweennessCentralities(graph, true) from sampleSize sources drawn
+// uniformly with replacement using rng. The dependencies on the sampled sources are
+// scaled by n/sampleSize. Every vertex is used as a source when sampleSize >= n.
+template <typename T> std::vector<double> getApproximateBetweennessCentralities(const T& graph, size_t sampleSize, size_t threadNumber=1);
+// Sample size for which every estimate is within epsilon*n*(n-2) of the betweenness
+// (epsilon*n*(n-2)/2 for an UndirectedGraph) with probability at least 1-delta.
+size_t getBetweennessSampleSize(size_t verticesNumber, double epsilon, double delta);
+// The edges of an UndirectedGraph are keyed with their smallest vertex first
+template <typename T> std::map<Edge, double> getEdgeBetweennessCentralities(const T& graph, bool normalizeWithGeodesicNumber=true, size_t threadNumber=1);
 
 template <typename T> std::vector<double> getShortestPathAverages(const T& graph);
 template <typename T> std::vector<double> getShortestPathHarmonicAverages(const T& graph);
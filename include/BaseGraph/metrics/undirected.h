@@ -38,6 +38,15 @@ std::list<VertexIndex> getKCore(size_t k, const std::vector<size_t>& kshells);
 std::list<size_t> getNeighbourhoodDegreesOfVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
 std::vector<double> getNeighbourDegreeSpectrum(const UndirectedGraph& graph, bool normalized=false);
 
+// Eccentricity of every vertex in its connected component from lower and upper bounds
+// refined by breadth-first searches (BoundingDiameters, Takes and Kosters, 2011). A
+// search from v gives max(e(v)-d(v,w), d(v,w)) <= e(w) <= e(v)+d(v,w) for every w of its
+// component. Sources alternate between the largest upper bound and the smallest lower
+// bound until every bound is tight, which usually takes a few dozen searches.
+std::vector<size_t> getEccentricities(const UndirectedGraph& graph);
+// Largest eccentricity. The searches stop once no upper bound exceeds the largest lower bound.
+size_t getDiameter(const UndirectedGraph& graph);
+
 double getModularity(const UndirectedGraph& graph, const std::vector<size_t>& vertexCommunities);
 
 } // namespace BaseGraph
@@ -0,0 +1,127 @@
+#ifndef BASE_GRAPH_PARALLEL_HPP
+#define BASE_GRAPH_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace BaseGraph{
+
+inline size_t getHardwareThreadNumber() {
+    size_t threadNumber = std::thread::hardware_concurrency();
+    return threadNumber == 0 ? 1 : threadNumber;
+}
+
+inline std::atomic<size_t>& getThreadNumberSetting() {
+    static std::atomic<size_t> threadNumber(1);
+    return threadNumber;
+}
+
+// Number of threads used by the metrics that do not take a thread number. 0 uses
+// every hardware thread. It must not be changed while a metric is computed.
+inline size_t getThreadNumber() { return getThreadNumberSetting(); }
+inline void setThreadNumber(size_t threadNumber) { getThreadNumberSetting() = threadNumber; }
+
+// Calls function(i) for every i in [begin, end). Each thread handles a contiguous
+// chunk of the range. threadNumber=0 uses every hardware thread. The first
+// exception thrown by a thread is rethrown once every thread has finished.
+template<typename Function>
+void parallelFor(size_t begin, size_t end, Function function, size_t threadNumber=0) {
+    if (begin >= end)
+        return;
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    threadNumber = std::min(threadNumber, end-begin);
+
+    if (threadNumber == 1) {
+        for (size_t i=begin; i<end; i++)
+            function(i);
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(threadNumber);
+    std::vector<std::thread> threads;
+    threads.reserve(threadNumber);
+
+    size_t chunkSize = (end-begin)/threadNumber, remainder = (end-begin)%threadNumber;
+    size_t chunkBegin = begin;
+    for (size_t thread=0; thread<threadNumber; thread++) {
+        size_t chunkEnd = chunkBegin + chunkSize + (thread < remainder ? 1 : 0);
+        threads.emplace_back([&function, &exceptions, thread, chunkBegin, chunkEnd]() {
+            try {
+                for (size_t i=chunkBegin; i<chunkEnd; i++)
+                    function(i);
+            } catch (...) {
+                exceptions[thread] = std::current_exception();
+            }
+        });
+        chunkBegin = chunkEnd;
+    }
+    for (auto& thread: threads)
+        thread.join();
+
+    for (auto& exception: exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+
+// Calls function(i) for every i in [begin, end). The threads take the next
+// grainSize indices from a shared counter whenever they are done with the previous
+// ones, so that a few expensive indices (e.g. hubs) do not hold back a thread while
+// the others are idle. Which thread handles an index is not deterministic, so
+// function must only write to memory owned by the index. threadNumber=0 uses every
+// hardware thread. The first exception thrown by a thread is rethrown once every
+// thread has finished.
+template<typename Function>
+void parallelForDynamic(size_t begin, size_t end, Function function, size_t threadNumber=0, size_t grainSize=64) {
+    if (begin >= end)
+        return;
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    if (grainSize == 0)
+        grainSize = 1;
+    threadNumber = std::min(threadNumber, (end-begin+grainSize-1)/grainSize);
+
+    if (threadNumber == 1) {
+        for (size_t i=begin; i<end; i++)
+            function(i);
+        return;
+    }
+
+    std::atomic<size_t> nextBegin(begin);
+    std::atomic<bool> failed(false);
+    std::vector<std::exception_ptr> exceptions(threadNumber);
+    std::vector<std::thread> threads;
+    threads.reserve(threadNumber);
+
+    for (size_t thread=0; thread<threadNumber; thread++) {
+        threads.emplace_back([&, thread]() {
+            try {
+                while (!failed) {
+                    size_t chunkBegin = nextBegin.fetch_add(grainSize);
+                    if (chunkBegin >= end)
+                        break;
+                    size_t chunkEnd = std::min(chunkBegin+grainSize, end);
+                    for (size_t i=chunkBegin; i<chunkEnd; i++)
+                        function(i);
+                }
+            } catch (...) {
+                exceptions[thread] = std::current_exception();
+                failed = true;
+            }
+        });
+    }
+    for (auto& thread: threads)
+        thread.join();
+
+    for (auto& exception: exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+
+} // namespace BaseGraph
+
+#endif
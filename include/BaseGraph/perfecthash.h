@@ -0,0 +1,75 @@
+#ifndef BASE_GRAPH_PERFECT_HASH_H
+#define BASE_GRAPH_PERFECT_HASH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/types.h"
+
+
+namespace BaseGraph{
+
+// Minimal perfect hash over the hash values of n keys (hash and displace). Key i of
+// the build vector is mapped to value i. Lookups of absent keys return an arbitrary
+// value, so the caller must compare the key with the one stored at the returned
+// value. Distinct keys with the same hash value cannot be separated by the perfect
+// hash: the first one is placed in it and the others are kept in a sorted list of
+// collisions, searched by the lookups given a predicate.
+class PerfectHashIndex {
+    public:
+        void build(const std::vector<size_t>& keyHashes);
+        void clear() { displacements.clear(); values.clear(); collisions.clear(); }
+
+        size_t size() const { return values.size()+collisions.size(); }
+        bool empty() const { return values.empty(); }
+        VertexIndex find(size_t keyHash) const {
+            if (values.empty()) return SIZE_T_MAX;
+            return values[getPosition(keyHash, displacements[getBucket(keyHash)])];
+        }
+        // Value v of the key for which isKey(v) is true, or SIZE_T_MAX
+        template<typename Predicate>
+        VertexIndex find(size_t keyHash, Predicate isKey) const {
+            VertexIndex value = find(keyHash);
+            if (value != SIZE_T_MAX && isKey(value))
+                return value;
+            auto collision = std::lower_bound(collisions.begin(), collisions.end(), std::make_pair(keyHash, VertexIndex(0)));
+            for (; collision != collisions.end() && collision->first == keyHash; ++collision)
+                if (isKey(collision->second))
+                    return collision->second;
+            return SIZE_T_MAX;
+        }
+        // Keys whose hash value is the one of a smaller key, sorted by hash value
+        const std::vector<std::pair<size_t, VertexIndex>>& getCollisions() const { return collisions; }
+        void prefetch(size_t keyHash) const {
+            if (!values.empty()) prefetchMemory(&displacements[getBucket(keyHash)]); }
+
+        void writeInBinaryStream(std::ostream& stream) const;
+        // Throws runtime_error when the stream is corrupted or, if expectedKeyNumber is
+        // given, when the index does not have this number of keys.
+        void loadFromBinaryStream(std::istream& stream, size_t expectedKeyNumber=SIZE_T_MAX);
+
+    private:
+        std::vector<uint32_t> displacements;
+        std::vector<VertexIndex> values;
+        std::vector<std::pair<size_t, VertexIndex>> collisions;
+
+        static uint64_t mix(uint64_t value) {
+            value ^= value >> 30;
+            value *= 0xbf58476d1ce4e5b9ULL;
+            value ^= value >> 27;
+            value *= 0x94d049bb133111ebULL;
+            value ^= value >> 31;
+            return value;
+        }
+        size_t getBucket(size_t keyHash) const { return mix(keyHash) % displacements.size(); }
+        size_t getPosition(size_t keyHash, uint32_t displacement) const {
+            return mix(keyHash + (displacement+1ULL)*0x9e3779b97f4a7c15ULL) % values.size(); }
+};
+
+} // namespace BaseGraph
+
+#endif
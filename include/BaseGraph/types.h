@@ -4,10 +4,13 @@
 #include <cstddef>
 #include <vector>
 #include <list>
+#include <limits>
 
 
 namespace BaseGraph{
 
+const size_t SIZE_T_MAX = std::numeric_limits<size_t>::max();
+
 typedef size_t VertexIndex;
 typedef std::pair<VertexIndex, VertexIndex> Edge;
 typedef std::list<VertexIndex> Successors;
@@ -16,6 +19,15 @@ typedef std::vector<std::vector<size_t>> AdjacencyMatrix;
 
 typedef unsigned int EdgeMultiplicity;
 
+
+inline void prefetchMemory(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void) address;
+#endif
+}
+
 } // namespace BaseGraph
 
 #endif
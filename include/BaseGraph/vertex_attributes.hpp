@@ -0,0 +1,267 @@
+#ifndef BASE_GRAPH_VERTEX_ATTRIBUTES_HPP
+#define BASE_GRAPH_VERTEX_ATTRIBUTES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/types.h"
+
+
+namespace BaseGraph{
+
+// Named columns of plain values indexed by VertexIndex. Each attribute is stored
+// in its own contiguous array, so that updating one attribute of every vertex
+// streams a single array.
+//
+// The store does not keep a reference to the graph: its vertex number is copied at
+// construction and is not updated by addVertex or resize on the graph. Call resize
+// (or resizeToGraph) after adding vertices to the graph. Accesses by vertex index
+// are only checked against the vertex number of the store.
+class VertexAttributes {
+    // Written in the files instead of the compiler-specific name of the type
+    enum ValueCategory: uint8_t { SIGNED_INTEGER=1, UNSIGNED_INTEGER=2, FLOATING_POINT=3, OTHER_VALUE=4 };
+
+    template<typename T>
+    static uint64_t getTypeCode() {
+        ValueCategory category = std::is_floating_point<T>::value ? FLOATING_POINT
+                               : std::is_integral<T>::value ? (std::is_signed<T>::value ? SIGNED_INTEGER : UNSIGNED_INTEGER)
+                               : OTHER_VALUE;
+        return (uint64_t(category) << 32) | sizeof(T);
+    }
+
+    struct Column {
+        virtual ~Column() {}
+        virtual Column* clone() const = 0;
+        virtual void resize(size_t vertexNumber) = 0;
+        virtual uint64_t getTypeCode() const = 0;
+        virtual void write(std::ostream& stream) const = 0;
+        virtual void read(std::istream& stream) = 0;
+    };
+
+    template<typename T>
+    struct TypedColumn: public Column {
+        std::vector<T> values;
+        T defaultValue;
+
+        TypedColumn(size_t vertexNumber, const T& defaultValue): values(vertexNumber, defaultValue), defaultValue(defaultValue) {}
+        Column* clone() const { return new TypedColumn<T>(*this); }
+        void resize(size_t vertexNumber) { values.resize(vertexNumber, defaultValue); }
+        uint64_t getTypeCode() const { return VertexAttributes::getTypeCode<T>(); }
+        void write(std::ostream& stream) const { stream.write((const char*) values.data(), values.size()*sizeof(T)); }
+        void read(std::istream& stream) { stream.read((char*) values.data(), values.size()*sizeof(T)); }
+    };
+
+    size_t vertexNumber;
+    std::map<std::string, std::unique_ptr<Column>> columns;
+
+    public:
+        explicit VertexAttributes(size_t vertexNumber=0): vertexNumber(vertexNumber) {}
+        template<typename Graph, typename = decltype(std::declval<const Graph&>().getSize())>
+            explicit VertexAttributes(const Graph& graph): VertexAttributes(graph.getSize()) {}
+        VertexAttributes(const VertexAttributes& other): vertexNumber(other.vertexNumber) {
+            for (auto& column: other.columns)
+                columns[column.first].reset(column.second->clone());
+        }
+        VertexAttributes& operator=(const VertexAttributes& other) {
+            if (this != &other) {
+                VertexAttributes copy(other);
+                vertexNumber = copy.vertexNumber;
+                columns.swap(copy.columns);
+            }
+            return *this;
+        }
+
+        size_t getVertexNumber() const { return vertexNumber; }
+        void resize(size_t newVertexNumber) {
+            for (auto& column: columns)
+                column.second->resize(newVertexNumber);
+            vertexNumber = newVertexNumber;
+        }
+        template<typename Graph>
+            void resizeToGraph(const Graph& graph) { resize(graph.getSize()); }
+
+        template<typename T>
+            std::vector<T>& addAttribute(const std::string& name, const T& defaultValue=T());
+        void removeAttribute(const std::string& name) { columns.erase(name); }
+        bool hasAttribute(const std::string& name) const { return columns.find(name) != columns.end(); }
+        std::vector<std::string> getAttributeNames() const {
+            std::vector<std::string> names;
+            for (auto& column: columns)
+                names.push_back(column.first);
+            return names;
+        }
+
+        // The returned array has one value per vertex. It must not be resized directly.
+        template<typename T>
+            std::vector<T>& getAttribute(const std::string& name) { return getColumn<T>(name).values; }
+        template<typename T>
+            const std::vector<T>& getAttribute(const std::string& name) const { return getColumn<T>(name).values; }
+
+        template<typename T>
+            void fill(const std::string& name, const T& value);
+        template<typename T>
+            void assign(const std::string& name, const std::vector<T>& values);
+        template<typename T, typename Iterator>
+            void setValues(const std::string& name, Iterator firstVertex, Iterator lastVertex, const T& value);
+
+        // The loaded file must contain the same vertex number. Its attributes must
+        // already be declared with addAttribute using the same type.
+        void writeInBinaryFile(const std::string& fileName) const;
+        void writeInBinaryFile(std::ofstream& fileStream) const;
+        void loadFromBinaryFile(const std::string& fileName);
+        void loadFromBinaryFile(std::ifstream& fileStream);
+
+    private:
+        template<typename T>
+            TypedColumn<T>& getColumn(const std::string& name) const;
+
+        static void writeString(std::ostream& stream, const std::string& value) {
+            uint64_t length = value.size();
+            stream.write((const char*) &length, sizeof(length));
+            stream.write(value.data(), length);
+        }
+        static std::string readString(std::istream& stream) {
+            uint64_t length = 0;
+            stream.read((char*) &length, sizeof(length));
+            if (!stream || length > 1<<16)
+                throw std::runtime_error("Corrupted vertex attributes file.");
+            std::string value(length, '\0');
+            stream.read(&value[0], length);
+            return value;
+        }
+};
+
+
+template<typename T>
+std::vector<T>& VertexAttributes::addAttribute(const std::string& name, const T& defaultValue) {
+    static_assert(std::is_trivially_copyable<T>::value, "Vertex attributes must be trivially copyable");
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> is not contiguous: use uint8_t instead of bool");
+
+    if (hasAttribute(name))
+        throw std::invalid_argument("Vertex attribute \"" + name + "\" already exists.");
+
+    TypedColumn<T>* column = new TypedColumn<T>(vertexNumber, defaultValue);
+    columns[name].reset(column);
+    return column->values;
+}
+
+template<typename T>
+VertexAttributes::TypedColumn<T>& VertexAttributes::getColumn(const std::string& name) const {
+    auto it = columns.find(name);
+    if (it == columns.end())
+        throw std::invalid_argument("Vertex attribute \"" + name + "\" does not exist.");
+
+    TypedColumn<T>* column = dynamic_cast<TypedColumn<T>*>(it->second.get());
+    if (column == nullptr)
+        throw std::invalid_argument("Vertex attribute \"" + name + "\" is not of the requested type.");
+    return *column;
+}
+
+template<typename T>
+void VertexAttributes::fill(const std::string& name, const T& value) {
+    auto& values = getAttribute<T>(name);
+    std::fill(values.begin(), values.end(), value);
+}
+
+template<typename T>
+void VertexAttributes::assign(const std::string& name, const std::vector<T>& newValues) {
+    auto& values = getAttribute<T>(name);
+    if (newValues.size() != values.size())
+        throw std::invalid_argument("The values vector must be the size of the graph.");
+    std::copy(newValues.begin(), newValues.end(), values.begin());
+}
+
+template<typename T, typename Iterator>
+void VertexAttributes::setValues(const std::string& name, Iterator firstVertex, Iterator lastVertex, const T& value) {
+    auto& values = getAttribute<T>(name);
+    // Nothing is modified when a vertex is out of range
+    for (Iterator vertex=firstVertex; vertex!=lastVertex; ++vertex)
+        if (*vertex >= vertexNumber)
+            throw std::out_of_range("Vertex index (" + std::to_string(*vertex) +
+                    ") greater than the graph's size("+ std::to_string(vertexNumber) +").");
+    for (Iterator vertex=firstVertex; vertex!=lastVertex; ++vertex)
+        values[*vertex] = value;
+}
+
+
+static const char VERTEX_ATTRIBUTES_FILE_TAG[] = "BaseGraphAttributes2";
+
+inline void VertexAttributes::writeInBinaryFile(const std::string& fileName) const {
+    std::ofstream fileStream(fileName, std::ios::binary);
+    writeInBinaryFile(fileStream);
+    fileStream.close();
+}
+
+inline void VertexAttributes::writeInBinaryFile(std::ofstream& fileStream) const {
+    if(!fileStream.is_open())
+        throw std::runtime_error("Could not open file.");
+
+    uint64_t fileVertexNumber = vertexNumber, columnNumber = columns.size();
+    fileStream.write(VERTEX_ATTRIBUTES_FILE_TAG, sizeof(VERTEX_ATTRIBUTES_FILE_TAG));
+    fileStream.write((const char*) &fileVertexNumber, sizeof(fileVertexNumber));
+    fileStream.write((const char*) &columnNumber, sizeof(columnNumber));
+
+    for (auto& column: columns) {
+        uint64_t typeCode = column.second->getTypeCode();
+        writeString(fileStream, column.first);
+        fileStream.write((const char*) &typeCode, sizeof(typeCode));
+        column.second->write(fileStream);
+    }
+}
+
+inline void VertexAttributes::loadFromBinaryFile(const std::string& fileName) {
+    std::ifstream fileStream(fileName.c_str(), std::ios::in | std::ios::binary);
+    loadFromBinaryFile(fileStream);
+    fileStream.close();
+}
+
+inline void VertexAttributes::loadFromBinaryFile(std::ifstream& fileStream) {
+    if(!fileStream.is_open())
+        throw std::runtime_error("Could not open file.");
+
+    char tag[sizeof(VERTEX_ATTRIBUTES_FILE_TAG)];
+    fileStream.read(tag, sizeof(tag));
+    if (!fileStream || std::string(tag, sizeof(tag)-1) != VERTEX_ATTRIBUTES_FILE_TAG)
+        throw std::runtime_error("File does not contain vertex attributes.");
+
+    uint64_t fileVertexNumber, columnNumber;
+    fileStream.read((char*) &fileVertexNumber, sizeof(fileVertexNumber));
+    fileStream.read((char*) &columnNumber, sizeof(columnNumber));
+    if (!fileStream)
+        throw std::runtime_error("Corrupted vertex attributes file.");
+    if (fileVertexNumber != vertexNumber)
+        throw std::runtime_error("Vertex attributes file does not have the vertex number of the graph.");
+
+    // Values are read in copies so that a failed load leaves the attributes unchanged
+    VertexAttributes loaded(*this);
+    for (uint64_t i=0; i<columnNumber; i++) {
+        std::string name = readString(fileStream);
+        uint64_t typeCode;
+        fileStream.read((char*) &typeCode, sizeof(typeCode));
+        if (!fileStream)
+            throw std::runtime_error("Corrupted vertex attributes file.");
+
+        auto it = loaded.columns.find(name);
+        if (it == loaded.columns.end())
+            throw std::runtime_error("Vertex attribute \"" + name + "\" of the file is not declared.");
+        if (it->second->getTypeCode() != typeCode)
+            throw std::runtime_error("Vertex attribute \"" + name + "\" of the file has another type.");
+
+        it->second->read(fileStream);
+        if (!fileStream)
+            throw std::runtime_error("Corrupted vertex attributes file.");
+    }
+    columns.swap(loaded.columns);
+}
+
+} // namespace BaseGraph
+
+#endif
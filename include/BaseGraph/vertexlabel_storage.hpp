@@ -0,0 +1,302 @@
+#ifndef BASE_GRAPH_VERTEX_LABEL_STORAGE_HPP
+#define BASE_GRAPH_VERTEX_LABEL_STORAGE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/types.h"
+
+
+namespace BaseGraph{
+
+// Labels that define operator< (a strict weak ordering consistent with operator==)
+// can be indexed with an ordered map when they are not hashable.
+template<typename T, typename=void>
+struct IsOrderable: std::false_type {};
+template<typename T>
+struct IsOrderable<T, decltype(void(std::declval<const T&>() < std::declval<const T&>()))>: std::true_type {};
+
+
+// Every storage maps VertexIndex -> label and label -> VertexIndex. find returns
+// SIZE_T_MAX when the label is absent. When the same label is pushed twice, find
+// returns the index of the last one. clearIndex releases the label -> VertexIndex
+// index (find must not be used until rebuildIndex is called).
+// Batched lookups first compute getLookupHash of every label and prefetch the
+// memory it points to, then call find with the precomputed hash. operator[] returns
+// const_reference, which is a value rather than a reference for bool labels (stored
+// in a std::vector<bool>) and for the string arena.
+
+template<typename VertexLabel>
+class UnindexedLabels {
+    std::vector<VertexLabel> labels;
+
+    public:
+        typedef std::vector<VertexLabel> Labels;
+        typedef typename std::vector<VertexLabel>::const_reference const_reference;
+
+        const Labels& getLabels() const { return labels; }
+        size_t size() const { return labels.size(); }
+        void reserve(size_t labelNumber) { labels.reserve(labelNumber); }
+        const_reference operator[](VertexIndex vertex) const { return labels[vertex]; }
+
+        VertexIndex find(const VertexLabel& label, size_t=0) const {
+            for (VertexIndex i=0; i<labels.size(); i++)
+                if (labels[i] == label)
+                    return i;
+            return SIZE_T_MAX;
+        }
+        size_t getLookupHash(const VertexLabel&) const { return 0; }
+        void prefetch(size_t) const {}
+        void push_back(const VertexLabel& label) { labels.push_back(label); }
+        void replace(VertexIndex vertex, const VertexLabel& newLabel) { labels[vertex] = newLabel; }
+        void clearIndex() {}
+        void rebuildIndex() {}
+};
+
+// Hash tables look labels up by bucket: the lookup hash of a label is the index of
+// its bucket, computed with the table's hasher, and prefetching loads the first
+// node of the bucket. Ordered maps have no bucket to prefetch.
+template<typename Table>
+struct TableLookup {
+    template<typename Key>
+    static size_t getLookupHash(const Table&, const Key&) { return 0; }
+    static void prefetch(const Table&, size_t) {}
+};
+
+template<typename Key, typename Value, typename Hash>
+struct TableLookup<std::unordered_map<Key, Value, Hash>> {
+    typedef std::unordered_map<Key, Value, Hash> Table;
+
+    static size_t getLookupHash(const Table& table, const Key& key) {
+        return table.empty() ? 0 : table.bucket(key);
+    }
+    static void prefetch(const Table& table, size_t bucket) {
+        if (table.empty() || bucket >= table.bucket_count())
+            return;
+        auto node = table.begin(bucket);
+        if (node != table.end(bucket))
+            prefetchMemory(&*node);
+    }
+};
+
+template<typename VertexLabel, typename Table>
+class IndexedLabels {
+    std::vector<VertexLabel> labels;
+    Table table;
+
+    public:
+        typedef std::vector<VertexLabel> Labels;
+        typedef typename std::vector<VertexLabel>::const_reference const_reference;
+
+        const Labels& getLabels() const { return labels; }
+        size_t size() const { return labels.size(); }
+        void reserve(size_t labelNumber) { labels.reserve(labelNumber); }
+        const_reference operator[](VertexIndex vertex) const { return labels[vertex]; }
+
+        VertexIndex find(const VertexLabel& label, size_t=0) const {
+            auto it = table.find(label);
+            return it == table.end() ? SIZE_T_MAX : it->second;
+        }
+        size_t getLookupHash(const VertexLabel& label) const { return TableLookup<Table>::getLookupHash(table, label); }
+        void prefetch(size_t bucket) const { TableLookup<Table>::prefetch(table, bucket); }
+        void push_back(const VertexLabel& label) {
+            table[label] = labels.size();
+            labels.push_back(label);
+        }
+        void replace(VertexIndex vertex, const VertexLabel& newLabel) {
+            table.erase(labels[vertex]);
+            labels[vertex] = newLabel;
+            table[newLabel] = vertex;
+        }
+        void clearIndex() { Table().swap(table); }
+        void rebuildIndex() {
+            for (VertexIndex vertex=0; vertex<labels.size(); vertex++)
+                table[labels[vertex]] = vertex;
+        }
+};
+
+
+// Stores every string label once in a contiguous character buffer. The open
+// addressing table only holds vertex indices and compares the queried label
+// against the buffer, so no label is duplicated nor allocated individually.
+class StringLabelArena {
+    std::vector<char> characters;
+    std::vector<size_t> offsets;
+    std::vector<uint32_t> lengths;
+    std::vector<VertexIndex> slots;
+    size_t unusedCharacters = 0;
+
+    public:
+        typedef StringLabelArena Labels;
+        typedef std::string value_type;
+        typedef std::string const_reference;
+
+        const Labels& getLabels() const { return *this; }
+        size_t size() const { return offsets.size(); }
+        size_t getCharacterNumber() const { return characters.size(); }
+        void reserve(size_t labelNumber, size_t characterNumber=0) {
+            offsets.reserve(labelNumber);
+            lengths.reserve(labelNumber);
+            characters.reserve(characterNumber);
+            if (2*labelNumber > slots.size())
+                rehash(2*labelNumber);
+        }
+
+        std::string operator[](VertexIndex vertex) const {
+            return std::string(characters.data()+offsets[vertex], lengths[vertex]); }
+
+        VertexIndex find(const std::string& label) const { return find(label, getLookupHash(label)); }
+        VertexIndex find(const std::string& label, size_t labelHash) const {
+            if (slots.empty())
+                return SIZE_T_MAX;
+            return slots[findSlot(label.data(), label.size(), labelHash)];
+        }
+        size_t getLookupHash(const std::string& label) const { return hash(label.data(), label.size()); }
+        void prefetch(size_t labelHash) const {
+            if (!slots.empty()) prefetchMemory(&slots[labelHash & (slots.size()-1)]); }
+        void push_back(const std::string& label) {
+            if (2*(offsets.size()+1) > slots.size())
+                rehash(std::max<size_t>(16, 2*slots.size()));
+
+            VertexIndex vertex = offsets.size();
+            append(label);
+            slots[findSlot(label.data(), label.size())] = vertex;
+        }
+        void replace(VertexIndex vertex, const std::string& newLabel) {
+            size_t slot = findSlot(characters.data()+offsets[vertex], lengths[vertex]);
+            if (slots[slot] == vertex)
+                eraseSlot(slot);
+
+            unusedCharacters += lengths[vertex];
+            offsets[vertex] = characters.size();
+            lengths[vertex] = newLabel.size();
+            characters.insert(characters.end(), newLabel.begin(), newLabel.end());
+            slots[findSlot(newLabel.data(), newLabel.size())] = vertex;
+
+            if (unusedCharacters > characters.size()/2)
+                compact();
+        }
+        void clearIndex() { std::vector<VertexIndex>().swap(slots); }
+        void rebuildIndex() { rehash(2*size()); }
+
+        struct const_iterator {
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::string value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const std::string* pointer;
+            typedef std::string reference;
+
+            const StringLabelArena* arena;
+            VertexIndex position;
+            const_iterator(const StringLabelArena* arena, VertexIndex position): arena(arena), position(position) {}
+            bool operator==(const const_iterator& rhs) const { return position == rhs.position; }
+            bool operator!=(const const_iterator& rhs) const { return position != rhs.position; }
+            std::string operator*() const { return (*arena)[position]; }
+            const_iterator& operator++() { ++position; return *this; }
+            const_iterator operator++(int) { const_iterator tmp(*this); ++position; return tmp; }
+        };
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size()); }
+
+        static size_t hash(const char* label, size_t length) {
+            // FNV-1a followed by a 64 bits finalizer, since the table uses the low bits
+            uint64_t value = 14695981039346656037ULL;
+            for (size_t i=0; i<length; i++) {
+                value ^= (unsigned char) label[i];
+                value *= 1099511628211ULL;
+            }
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            return value;
+        }
+
+    private:
+        bool isLabelOf(VertexIndex vertex, const char* label, size_t length) const {
+            return lengths[vertex] == length && std::memcmp(characters.data()+offsets[vertex], label, length) == 0;
+        }
+
+        // Returns the slot containing the label or the empty slot where it would be inserted
+        size_t findSlot(const char* label, size_t length) const { return findSlot(label, length, hash(label, length)); }
+        size_t findSlot(const char* label, size_t length, size_t labelHash) const {
+            size_t mask = slots.size()-1;
+            size_t slot = labelHash & mask;
+            while (slots[slot] != SIZE_T_MAX && !isLabelOf(slots[slot], label, length))
+                slot = (slot+1) & mask;
+            return slot;
+        }
+
+        // Backward shift deletion keeps the linear probing sequences unbroken
+        void eraseSlot(size_t slot) {
+            size_t mask = slots.size()-1;
+            size_t next = (slot+1) & mask;
+            while (slots[next] != SIZE_T_MAX) {
+                VertexIndex vertex = slots[next];
+                size_t ideal = hash(characters.data()+offsets[vertex], lengths[vertex]) & mask;
+                if (((next-ideal) & mask) >= ((next-slot) & mask)) {
+                    slots[slot] = vertex;
+                    slot = next;
+                }
+                next = (next+1) & mask;
+            }
+            slots[slot] = SIZE_T_MAX;
+        }
+
+        void append(const std::string& label) {
+            offsets.push_back(characters.size());
+            lengths.push_back(label.size());
+            characters.insert(characters.end(), label.begin(), label.end());
+        }
+
+        void rehash(size_t minimalSlotNumber) {
+            size_t slotNumber = 16;
+            while (slotNumber < minimalSlotNumber)
+                slotNumber *= 2;
+
+            slots.assign(slotNumber, SIZE_T_MAX);
+            for (VertexIndex vertex=0; vertex<offsets.size(); vertex++)
+                slots[findSlot(characters.data()+offsets[vertex], lengths[vertex])] = vertex;
+        }
+
+        void compact() {
+            std::vector<char> compactCharacters;
+            compactCharacters.reserve(characters.size()-unusedCharacters);
+            for (VertexIndex vertex=0; vertex<offsets.size(); vertex++) {
+                size_t offset = compactCharacters.size();
+                compactCharacters.insert(compactCharacters.end(),
+                        characters.begin()+offsets[vertex], characters.begin()+offsets[vertex]+lengths[vertex]);
+                offsets[vertex] = offset;
+            }
+            characters.swap(compactCharacters);
+            unusedCharacters = 0;
+        }
+};
+
+
+template<typename VertexLabel, bool isHashable, typename LabelHash>
+struct LabelStorage {
+    typedef typename std::conditional<isHashable,
+                IndexedLabels<VertexLabel, std::unordered_map<VertexLabel, VertexIndex, LabelHash>>,
+                typename std::conditional<IsOrderable<VertexLabel>::value,
+                    IndexedLabels<VertexLabel, std::map<VertexLabel, VertexIndex>>,
+                    UnindexedLabels<VertexLabel>
+                >::type
+            >::type type;
+};
+
+template<>
+struct LabelStorage<std::string, true, std::hash<std::string>> {
+    typedef StringLabelArena type;
+};
+
+} // namespace BaseGraph
+
+#endif
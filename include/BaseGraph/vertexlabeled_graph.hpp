@@ -1,59 +1,73 @@
 #ifndef BASE_GRAPH_VERTEX_LABELED_GRAPH_HPP
 #define BASE_GRAPH_VERTEX_LABELED_GRAPH_HPP
 
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <fstream>
 #include <sstream>
 #include <string>
-
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "BaseGraph/directedgraph.h"
 #include "BaseGraph/undirectedgraph.h"
 #include "BaseGraph/edgelabeled_directedgraph.hpp"
 #include "BaseGraph/edgelabeled_undirectedgraph.hpp"
+#include "BaseGraph/vertexlabel_storage.hpp"
+#include "BaseGraph/perfecthash.h"
+#include "BaseGraph/parallel.hpp"
 
 
 namespace BaseGraph{
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash=std::hash<VertexLabel>>
 class VertexLabeledGraph: public GraphBase {
-    private:
-        struct Void {};
-        template<typename U> struct __HashTable { std::unordered_map<U, VertexIndex> table; };
+    template<typename, typename, bool, typename> friend class VertexLabeledGraph;
 
-        typedef typename std::conditional<isHashable, __HashTable<VertexLabel>, Void>::type HashTable;
-        HashTable verticesMapping;
+    public:
+        typedef typename LabelStorage<VertexLabel, isHashable, LabelHash>::type Storage;
+        typedef typename Storage::Labels Labels;
+        typedef typename Storage::const_reference LabelReference;
+        // const std::vector<VertexLabel>& except for the string arena, which has no
+        // vector of labels to refer to and returns a copy
+        typedef typename std::conditional<std::is_same<Labels, std::vector<VertexLabel>>::value,
+                    const std::vector<VertexLabel>&, std::vector<VertexLabel>>::type VerticesVector;
 
     protected:
-        std::vector<VertexLabel> vertices;
+        Storage vertices;
+        PerfectHashIndex frozenIndex;
+        bool frozen = false;
 
     public:
         VertexLabeledGraph(): GraphBase() {}
         VertexLabeledGraph(const std::list<std::pair<VertexLabel, VertexLabel>>& edgeList);
         VertexLabeledGraph(const GraphBase& source, const std::vector<VertexLabel>& vertices);
-        const std::vector<VertexLabel>& getVertices() const { return vertices; }
-
-        template<bool otherHashable>
-            bool operator==(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable>& other) const;
-        template<bool otherHashable>
-            bool operator!=(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable>& other) const { return !(this->operator==(other)); };
-
-
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<_hashable>::type
-            addVertex(const VertexLabel& vertex, bool force=false);
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<!_hashable>::type
-            addVertex(const VertexLabel& vertex, bool force=false);
-        bool isVertex(const VertexLabel& vertex) const;
-        const VertexLabel& getLabelFromIndex(VertexIndex vertexIdx) const { this->assertVertexInRange(vertexIdx); return vertices[vertexIdx]; }
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<_hashable, const VertexIndex&>::type
-            findVertexIndex(const VertexLabel& vertex) const;
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<!_hashable, const VertexIndex>::type
-            findVertexIndex(const VertexLabel& vertex) const;
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<_hashable>::type
-            changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel);
-        template<typename... Dummy, bool _hashable=isHashable> typename std::enable_if<!_hashable>::type
-            changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel);
+        // For VertexLabel=std::string with isHashable=true, the labels are stored in a
+        // StringLabelArena: getVertices then materialises a vector of copies and
+        // getLabelFromIndex returns the label by value. getVertexLabels gives access to
+        // the storage without copies for every label type.
+        VerticesVector getVertices() const { return getVerticesVector(std::is_same<Labels, std::vector<VertexLabel>>()); }
+        const Labels& getVertexLabels() const { return vertices.getLabels(); }
+
+        template<bool otherHashable, typename OtherHash>
+            bool operator==(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable, OtherHash>& other) const;
+        template<bool otherHashable, typename OtherHash>
+            bool operator!=(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable, OtherHash>& other) const { return !(this->operator==(other)); };
+
+
+        void addVertex(const VertexLabel& vertex, bool force=false);
+        bool isVertex(const VertexLabel& vertex) const { return findIndex(vertex) != SIZE_T_MAX; }
+        LabelReference getLabelFromIndex(VertexIndex vertexIdx) const { this->assertVertexInRange(vertexIdx); return vertices[vertexIdx]; }
+        VertexIndex findVertexIndex(const VertexLabel& vertex) const;
+        void changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel);
+
+        // Missing labels get index SIZE_T_MAX and are flagged in missingLabels instead of throwing
+        template<typename Iterator>
+            std::vector<VertexIndex> findVertexIndices(Iterator first, Iterator last, std::vector<bool>& missingLabels, size_t threadNumber=1) const;
+        template<typename Iterator>
+            std::vector<VertexLabel> getLabelsFromIndices(Iterator first, Iterator last) const;
         void removeVertexFromEdgeList(VertexLabel vertex) { this->removeVertexFromEdgeListIdx(findVertexIndex(vertex)); };
 
         void addEdge(VertexLabel source, VertexLabel destination, bool force=false) { this->addEdgeIdx(findVertexIndex(source), findVertexIndex(destination)); }
@@ -65,8 +79,17 @@ class VertexLabeledGraph: public GraphBase {
         size_t getOutDegree(VertexLabel vertex) const { return this->getOutDegreeIdx(findVertexIndex(vertex)); }
 
 
+        // A frozen graph replaces its label index by a minimal perfect hash of the labels.
+        // Vertices can no longer be added nor relabeled until unfreeze is called.
+        void freeze();
+        void freeze(const PerfectHashIndex& index);
+        void unfreeze();
+        bool isFrozen() const { return frozen; }
+        const PerfectHashIndex& getFrozenIndex() const { return frozenIndex; }
+
+
         template<typename Graph>
-        friend std::ostream& operator <<(std::ostream &stream, const VertexLabeledGraph<GraphBase, VertexLabel, isHashable>& graph) {
+        friend std::ostream& operator <<(std::ostream &stream, const VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>& graph) {
             stream << "Vertex labeled graph of" << typeid(Graph).name() << "graph of size: " << graph.getSize() << "\n"
                    << "Vertex label type \"" << typeid(VertexLabel).name() << "\" used as " << (isHashable ? "hashable": "not hashable") << "\n"
                    << "Neighbours of:\n";
@@ -81,24 +104,52 @@ class VertexLabeledGraph: public GraphBase {
             }
             return stream;
         }
+
+    private:
+        static const size_t LOOKUP_BLOCK_SIZE = 16;
+        const std::vector<VertexLabel>& getVerticesVector(std::true_type) const { return vertices.getLabels(); }
+        std::vector<VertexLabel> getVerticesVector(std::false_type) const {
+            return std::vector<VertexLabel>(vertices.getLabels().begin(), vertices.getLabels().end()); }
+        typedef std::integral_constant<bool, isHashable> HashableTag;
+
+        VertexIndex findIndex(const VertexLabel& vertex) const { return findIndex(vertex, getLookupHash(vertex)); }
+        VertexIndex findIndex(const VertexLabel& vertex, size_t labelHash) const {
+            return frozen ? findFrozenIndex(vertex, labelHash) : vertices.find(vertex, labelHash); }
+        size_t getLookupHash(const VertexLabel& vertex) const {
+            return frozen ? hashLabel(vertex, HashableTag()) : vertices.getLookupHash(vertex); }
+        void prefetchLookup(size_t labelHash) const {
+            if (frozen) frozenIndex.prefetch(labelHash);
+            else vertices.prefetch(labelHash);
+        }
+        template<typename Iterator>
+            void findIndicesOfBlock(Iterator first, size_t labelNumber, VertexIndex* indices) const;
+
+        VertexIndex findFrozenIndex(const VertexLabel& vertex, size_t labelHash) const {
+            return frozenIndex.find(labelHash, [&](VertexIndex vertexIdx) { return vertices[vertexIdx] == vertex; });
+        }
+        static size_t hashLabel(const VertexLabel& vertex, std::true_type) { return LabelHash()(vertex); }
+        static size_t hashLabel(const VertexLabel&, std::false_type) { return 0; }
+        void assertNotFrozen() const {
+            if (frozen) throw std::logic_error("Cannot modify the vertices of a frozen graph.");
+        }
 };
 
-template <typename VertexLabel, bool isHashable=false>
-using VertexLabeledDirectedGraph = VertexLabeledGraph<DirectedGraph, VertexLabel, isHashable>;
+template <typename VertexLabel, bool isHashable=false, typename LabelHash=std::hash<VertexLabel>>
+using VertexLabeledDirectedGraph = VertexLabeledGraph<DirectedGraph, VertexLabel, isHashable, LabelHash>;
 
-template <typename VertexLabel, bool isHashable=false>
-using VertexLabeledUndirectedGraph = VertexLabeledGraph<UndirectedGraph, VertexLabel, isHashable>;
+template <typename VertexLabel, bool isHashable=false, typename LabelHash=std::hash<VertexLabel>>
+using VertexLabeledUndirectedGraph = VertexLabeledGraph<UndirectedGraph, VertexLabel, isHashable, LabelHash>;
 
-template <typename VertexLabel, typename EdgeLabel, bool isHashable=false>
-using VertexAndEdgeLabeledDirectedGraph = VertexLabeledGraph<EdgeLabeledDirectedGraph<EdgeLabel>, VertexLabel, isHashable>;
+template <typename VertexLabel, typename EdgeLabel, bool isHashable=false, typename LabelHash=std::hash<VertexLabel>>
+using VertexAndEdgeLabeledDirectedGraph = VertexLabeledGraph<EdgeLabeledDirectedGraph<EdgeLabel>, VertexLabel, isHashable, LabelHash>;
 
-template <typename VertexLabel, typename EdgeLabel, bool isHashable=false>
-using VertexAndEdgeLabeledUndirectedGraph = VertexLabeledGraph<EdgeLabeledUndirectedGraph<EdgeLabel>, VertexLabel, isHashable>;
+template <typename VertexLabel, typename EdgeLabel, bool isHashable=false, typename LabelHash=std::hash<VertexLabel>>
+using VertexAndEdgeLabeledUndirectedGraph = VertexLabeledGraph<EdgeLabeledUndirectedGraph<EdgeLabel>, VertexLabel, isHashable, LabelHash>;
 
 
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::VertexLabeledGraph(const std::list<std::pair<VertexLabel, VertexLabel>>& edgeList) {
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::VertexLabeledGraph(const std::list<std::pair<VertexLabel, VertexLabel>>& edgeList) {
     for (auto& edge: edgeList) {
         // By default addVertex does not add existing labels
         addVertex(edge.first);
@@ -107,8 +158,8 @@ VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::VertexLabeledGraph(const
     }
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::VertexLabeledGraph(const GraphBase& source, const std::vector<VertexLabel>& verticesNames) {
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::VertexLabeledGraph(const GraphBase& source, const std::vector<VertexLabel>& verticesNames) {
     if (source.getSize() != verticesNames.size())
         throw std::invalid_argument("The vertices vector must be the size of the graph");
 
@@ -126,9 +177,9 @@ VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::VertexLabeledGraph(const
 }
 
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<bool otherHashable> 
-bool VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::operator==(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable>& other) const{
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+template<bool otherHashable, typename OtherHash>
+bool VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::operator==(const VertexLabeledGraph<GraphBase, VertexLabel, otherHashable, OtherHash>& other) const{
     bool sameObject = this->size == other.size;
     auto& _adjacencyList = this->adjacencyList;
 
@@ -155,88 +206,137 @@ bool VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::operator==(const Ve
     return sameObject;
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<_hashable>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::addVertex(const VertexLabel& vertex, bool force) {
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call addVertex");
-
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::addVertex(const VertexLabel& vertex, bool force) {
+    assertNotFrozen();
     if (force || !isVertex(vertex)) {
-        verticesMapping.table[vertex] = vertices.size();
         vertices.push_back(vertex);
         this->adjacencyList.push_back(std::list<VertexIndex>());
         this->size++;
     }
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<!_hashable>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::addVertex(const VertexLabel& vertex, bool force) {
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call addVertex");
-
-    if (force || !isVertex(vertex)) {
-        vertices.push_back(vertex);
-        this->adjacencyList.push_back(std::list<VertexIndex>());
-        this->size++;
-    }
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+VertexIndex VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::findVertexIndex(const VertexLabel& vertex) const {
+    VertexIndex vertexIdx = findIndex(vertex);
+    if (vertexIdx == SIZE_T_MAX)
+        throw std::invalid_argument("Vertex does not exist");
+    return vertexIdx;
 }
 
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel){
+    assertNotFrozen();
+    if (isVertex(newLabel)) throw std::invalid_argument("newLabel is already used as an attribute by another vertex.");
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-bool VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::isVertex(const VertexLabel& vertex) const{
-    bool exists = false;
+    vertices.replace(findVertexIndex(currentLabel), newLabel);
+}
 
-    for (VertexIndex i=0; i<this->size && !exists; ++i)
-        if (vertices[i] == vertex)
-            exists = true;
-    return exists;
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+template<typename Iterator>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::findIndicesOfBlock(Iterator first, size_t labelNumber, VertexIndex* indices) const {
+    // Every hash of the block is computed before the lookups so that their memory is fetched concurrently
+    size_t labelHashes[LOOKUP_BLOCK_SIZE];
+    Iterator label = first;
+    for (size_t i=0; i<labelNumber; i++, ++label) {
+        labelHashes[i] = getLookupHash(*label);
+        prefetchLookup(labelHashes[i]);
+    }
+    label = first;
+    for (size_t i=0; i<labelNumber; i++, ++label)
+        indices[i] = findIndex(*label, labelHashes[i]);
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<_hashable, const VertexIndex&>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::findVertexIndex(const VertexLabel& vertex) const {
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call findVertexIndex");
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+template<typename Iterator>
+std::vector<VertexIndex> VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::findVertexIndices(Iterator first, Iterator last, std::vector<bool>& missingLabels, size_t threadNumber) const {
+    size_t labelNumber = std::distance(first, last);
+    size_t blockNumber = (labelNumber+LOOKUP_BLOCK_SIZE-1)/LOOKUP_BLOCK_SIZE;
+    std::vector<VertexIndex> indices(labelNumber);
+
+    // The first label of every block is found in a single pass, so that iterators
+    // without random access are not advanced from the start for each block.
+    std::vector<Iterator> blockFirsts;
+    blockFirsts.reserve(blockNumber);
+    for (size_t block=0; block<blockNumber; block++) {
+        blockFirsts.push_back(first);
+        if (block+1 < blockNumber)
+            std::advance(first, LOOKUP_BLOCK_SIZE);
+    }
 
-    if (verticesMapping.table.find(vertex) != verticesMapping.table.end())
-        return verticesMapping.table.at(vertex);
-    throw std::invalid_argument("Vertex does not exist");
+    parallelFor(0, blockNumber, [&](size_t block) {
+        size_t blockBegin = block*LOOKUP_BLOCK_SIZE;
+        size_t blockSize = labelNumber-blockBegin < LOOKUP_BLOCK_SIZE ? labelNumber-blockBegin : LOOKUP_BLOCK_SIZE;
+        findIndicesOfBlock(blockFirsts[block], blockSize, &indices[blockBegin]);
+    }, threadNumber);
+
+    missingLabels.assign(labelNumber, false);
+    for (size_t i=0; i<labelNumber; i++)
+        if (indices[i] == SIZE_T_MAX)
+            missingLabels[i] = true;
+    return indices;
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<!_hashable, const VertexIndex>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::findVertexIndex(const VertexLabel& vertex) const {
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call findVertexIndex");
-    for (VertexIndex& i: *this)
-        if (vertices[i] == vertex)
-            return i;
-    throw std::invalid_argument("Vertex does not exist");
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+template<typename Iterator>
+std::vector<VertexLabel> VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::getLabelsFromIndices(Iterator first, Iterator last) const {
+    std::vector<VertexLabel> labels;
+    labels.reserve(std::distance(first, last));
+    for (Iterator vertexIdx=first; vertexIdx!=last; ++vertexIdx) {
+        this->assertVertexInRange(*vertexIdx);
+        labels.push_back(vertices[*vertexIdx]);
+    }
+    return labels;
 }
 
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::freeze() {
+    static_assert(isHashable, "Only graphs with hashable labels can be frozen");
+    if (frozen)
+        return;
+
+    std::vector<size_t> labelHashes;
+    labelHashes.reserve(vertices.size());
+    for (VertexIndex i=0; i<vertices.size(); i++)
+        labelHashes.push_back(hashLabel(vertices[i], HashableTag()));
+
+    // Labels with the same hash are kept apart as collisions, unless they are identical
+    frozenIndex.build(labelHashes);
+    for (auto& collision: frozenIndex.getCollisions()) {
+        const VertexLabel& label = vertices[collision.second];
+        if (frozenIndex.find(collision.first, [&](VertexIndex vertexIdx) { return vertices[vertexIdx] == label; }) != collision.second) {
+            frozenIndex.clear();
+            throw std::invalid_argument("Cannot freeze a graph with identical vertex labels.");
+        }
+    }
+    vertices.clearIndex();
+    frozen = true;
+}
+
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::freeze(const PerfectHashIndex& index) {
+    static_assert(isHashable, "Only graphs with hashable labels can be frozen");
+    if (index.size() != vertices.size())
+        throw std::invalid_argument("The perfect hash index does not have the size of the graph.");
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<_hashable>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel){
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call changeVertexObjectTo");
-    if (isVertex(newLabel)) throw std::invalid_argument("The object is already used as an attribute by another vertex.");
+    for (VertexIndex i=0; i<vertices.size(); i++)
+        if (index.find(hashLabel(vertices[i], HashableTag()), [&](VertexIndex vertexIdx) { return vertexIdx == i; }) != i)
+            throw std::invalid_argument("The perfect hash index does not match the vertex labels.");
 
-    VertexIndex vertexIndex = findVertexIndex(currentLabel);
-    vertices[vertexIndex] = newLabel;
-    verticesMapping.table.erase(currentLabel);
-    verticesMapping.table[newLabel] = vertexIndex;
+    frozenIndex = index;
+    if (!frozen)
+        vertices.clearIndex();
+    frozen = true;
 }
 
-template<typename GraphBase, typename VertexLabel, bool isHashable>
-template<typename... Dummy, bool _hashable>
-typename std::enable_if<!_hashable>::type
-VertexLabeledGraph<GraphBase, VertexLabel, isHashable>::changeVertexLabelTo(const VertexLabel& currentLabel, const VertexLabel& newLabel){
-    static_assert(sizeof...(Dummy)==0, "Do not specify template arguments to call changeVertexObjectTo");
-    if (isVertex(newLabel)) throw std::invalid_argument("newLabel is already used as an attribute by another vertex.");
+template<typename GraphBase, typename VertexLabel, bool isHashable, typename LabelHash>
+void VertexLabeledGraph<GraphBase, VertexLabel, isHashable, LabelHash>::unfreeze() {
+    if (!frozen)
+        return;
 
-    vertices[findVertexIndex(currentLabel)] = newLabel;
+    vertices.rebuildIndex();
+    frozenIndex.clear();
+    frozen = false;
 }
 
 } // namespace BaseGraph
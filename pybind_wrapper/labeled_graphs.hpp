@@ -1,11 +1,14 @@
 #ifndef BaseGraph_LABELED_GRAPH_PYBIND_H
 #define BaseGraph_LABELED_GRAPH_PYBIND_H
 
+#include <algorithm>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <sstream>
 
 #include "pybind11/pybind11.h"
+#include "pybind11/numpy.h"
 #include "pybind11/stl.h"
 
 #include "BaseGraph/vertexlabeled_graph.hpp"
@@ -16,6 +19,55 @@ namespace py = pybind11;
 using namespace BaseGraph;
 
 
+// Batches of numeric labels and of vertex indices are exchanged as numpy arrays.
+// Other labels (e.g. strings) are exchanged as lists.
+template<typename T>
+using PyArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+template<typename Label>
+using PyLabels = typename std::conditional<std::is_arithmetic<Label>::value, PyArray<Label>, std::vector<Label>>::type;
+
+template<typename T>
+static const T* beginOf(const PyArray<T>& array) { return array.data(); }
+template<typename T>
+static const T* endOf(const PyArray<T>& array) { return array.data()+array.size(); }
+template<typename T>
+static typename std::vector<T>::const_iterator beginOf(const std::vector<T>& vector) { return vector.begin(); }
+template<typename T>
+static typename std::vector<T>::const_iterator endOf(const std::vector<T>& vector) { return vector.end(); }
+
+template<typename T>
+static PyArray<T> toPyArray(const std::vector<T>& values) {
+    PyArray<T> array(values.size());
+    std::copy(values.begin(), values.end(), array.mutable_data());
+    return array;
+}
+static PyArray<bool> toPyArray(const std::vector<bool>& values) {
+    PyArray<bool> array(values.size());
+    std::copy(values.begin(), values.end(), array.mutable_data());
+    return array;
+}
+template<typename Label>
+static py::object toPyLabels(const std::vector<Label>& labels, std::true_type) { return toPyArray(labels); }
+template<typename Label>
+static py::object toPyLabels(const std::vector<Label>& labels, std::false_type) { return py::cast(labels); }
+
+template<typename Graph, typename Label>
+static py::tuple findVertexIndicesOfPyLabels(const Graph& graph, const PyLabels<Label>& labels, size_t threadNumber) {
+    std::vector<bool> missingLabels;
+    std::vector<VertexIndex> indices;
+    {
+        py::gil_scoped_release release;
+        indices = graph.findVertexIndices(beginOf(labels), endOf(labels), missingLabels, threadNumber);
+    }
+    return py::make_tuple(toPyArray(indices), toPyArray(missingLabels));
+}
+
+template<typename Graph, typename Label>
+static py::object getPyLabelsFromIndices(const Graph& graph, const PyArray<VertexIndex>& indices) {
+    return toPyLabels(graph.getLabelsFromIndices(beginOf(indices), endOf(indices)), std::is_arithmetic<Label>());
+}
+
+
 template<typename Label, bool isHashable>
 static void declareSpecializedVertexLabeledUndirectedGraph(py::class_<VertexLabeledUndirectedGraph<Label, isHashable>, UndirectedGraph>& pyClass);
 template<bool isHashable>
@@ -43,7 +95,9 @@ void declareVertexLabeledUndirectedGraph(py::module &m, const std::string &types
     .def("add_vertex",                  [](CppClass& self, Label v, bool force) { self.addVertex(v, force); }, py::arg("vertex label"), py::arg("force")=false)
     .def("remove_vertex_from_edgelist", &CppClass::removeVertexFromEdgeList, py::arg("vertex label"))
     .def("change_vertex_label_to",      [](CppClass& self, Label v1, Label v2) { self.changeVertexLabelTo(v1,v2); }, py::arg("previous label"), py::arg("new label"))
-    .def("get_vertices",                &CppClass::getVertices)
+    .def("get_vertices",                [](const CppClass& self) { return std::vector<Label>(self.getVertices()); })
+    .def("find_vertex_indices",         &findVertexIndicesOfPyLabels<CppClass, Label>, py::arg("vertex labels"), py::arg("thread number")=1)
+    .def("get_labels_from_indices",     &getPyLabelsFromIndices<CppClass, Label>, py::arg("vertex indices"))
 
     .def("add_edge",    &CppClass::addEdge, py::arg("vertex1 label"), py::arg("vertex2 label"), py::arg("force")=false)
     .def("is_edge",     &CppClass::isEdge, py::arg("vertex1 label"), py::arg("vertex2 label"))
@@ -54,6 +108,12 @@ void declareVertexLabeledUndirectedGraph(py::module &m, const std::string &types
 
     .def("get_degree",        [](const CppClass& self, Label v){ return self.getOutDegree(v); }, py::arg("vertex label"))
 
+    .def("freeze",    [](CppClass& self) { self.freeze(); })
+    .def("unfreeze",  &CppClass::unfreeze)
+    .def("is_frozen", &CppClass::isFrozen)
+    .def("write_frozen_label_index_in_binary_file", [](const CppClass& self, const std::string& fileName) { writeFrozenLabelIndexInBinaryFile(self, fileName); })
+    .def("load_frozen_label_index_from_binary_file", [](CppClass& self, const std::string& fileName) { loadFrozenLabelIndexFromBinaryFile(self, fileName); })
+
     .def("__eq__",  [](const CppClass& self, const CppClass& other) {return self == other;}, py::is_operator())
     .def("__neq__", [](const CppClass& self, const CppClass& other) {return self != other;}, py::is_operator())
     .def("__str__", [](const CppClass& self) { std::ostringstream ret; ret << self; return ret.str(); });
@@ -78,7 +138,9 @@ void declareVertexLabeledDirectedGraph(py::module &m, const std::string &typestr
     .def("add_vertex",                  [](CppClass& self, Label v, bool force){ self.addVertex(v, force); }, py::arg("vertex label"), py::arg("force")=false)
     .def("remove_vertex_from_edgelist", &CppClass::removeVertexFromEdgeList, py::arg("vertex label"))
     .def("change_vertex_label_to",      [](CppClass& self, Label v1, Label v2){ self.changeVertexLabelTo(v1,v2); }, py::arg("previous label"), py::arg("new label"))
-    .def("get_vertices",                &CppClass::getVertices)
+    .def("get_vertices",                [](const CppClass& self) { return std::vector<Label>(self.getVertices()); })
+    .def("find_vertex_indices",         &findVertexIndicesOfPyLabels<CppClass, Label>, py::arg("vertex labels"), py::arg("thread number")=1)
+    .def("get_labels_from_indices",     &getPyLabelsFromIndices<CppClass, Label>, py::arg("vertex indices"))
 
     .def("add_edge",    &CppClass::addEdge, py::arg("source label"), py::arg("destination label"), py::arg("force")=false)
     .def("is_edge",     &CppClass::isEdge, py::arg("source label"), py::arg("destination label"))
@@ -87,6 +149,12 @@ void declareVertexLabeledDirectedGraph(py::module &m, const std::string &typestr
     .def("get_in_degree",    [](const CppClass& self, Label v) { return self.getInDegreeIdx(self.findVertexIndex(v)); }, py::arg("vertex label"))
     .def("get_out_degree",   [](const CppClass& self, Label v) { return self.getOutDegree(v); }, py::arg("vertex label"))
 
+    .def("freeze",    [](CppClass& self) { self.freeze(); })
+    .def("unfreeze",  &CppClass::unfreeze)
+    .def("is_frozen", &CppClass::isFrozen)
+    .def("write_frozen_label_index_in_binary_file", [](const CppClass& self, const std::string& fileName) { writeFrozenLabelIndexInBinaryFile(self, fileName); })
+    .def("load_frozen_label_index_from_binary_file", [](CppClass& self, const std::string& fileName) { loadFrozenLabelIndexFromBinaryFile(self, fileName); })
+
     .def("write_edgelist_in_text_file",   py::overload_cast<const CppClass&, const std::string&>(&writeEdgeListInTextFile<Label, isHashable>))
     .def("write_edgelist_in_text_file",   py::overload_cast<const CppClass&, std::ofstream&>(&writeEdgeListInTextFile<Label, isHashable>))
 
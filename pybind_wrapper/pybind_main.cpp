@@ -7,12 +7,19 @@
 
 #include "BaseGraph/directedgraph.h"
 #include "BaseGraph/undirectedgraph.h"
+#include "BaseGraph/parallel.hpp"
 
 #include "BaseGraph/fileio.h"
 #include "BaseGraph/metrics/directed.h"
 #include "BaseGraph/metrics/general.h"
 #include "BaseGraph/metrics/undirected.h"
 #include "BaseGraph/algorithms/graphpaths.h"
+#include "BaseGraph/algorithms/components.h"
+#include "BaseGraph/algorithms/distancematrix.h"
+#include "BaseGraph/algorithms/distanceoracle.h"
+#include "BaseGraph/algorithms/hyperanf.h"
+#include "BaseGraph/algorithms/prunedlandmarklabeling.h"
+#include "BaseGraph/algorithms/triangles.h"
 #include "BaseGraph/algorithms/percolation.h"
 #include "BaseGraph/algorithms/randomgraphs.h"
 #include "BaseGraph/algorithms/layeredconfigurationmodel.h"
@@ -24,6 +31,31 @@ namespace py = pybind11;
 using namespace BaseGraph;
 
 
+template <typename Distance>
+static void defineDistanceMatrix(py::module& m, const char* name) {
+    py::class_<DistanceMatrix<Distance>> (m, name)
+        .def(py::init<>())
+        .def(py::init<const DirectedGraph&, size_t>(), py::arg("graph"), py::arg("thread number")=1,
+                py::call_guard<py::gil_scoped_release>())
+        .def(py::init<const UndirectedGraph&, size_t>(), py::arg("graph"), py::arg("thread number")=1,
+                py::call_guard<py::gil_scoped_release>())
+        .def(py::init<const DirectedGraph&, const std::string&, size_t>(), py::arg("graph"), py::arg("filename"),
+                py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>())
+        .def(py::init<const UndirectedGraph&, const std::string&, size_t>(), py::arg("graph"), py::arg("filename"),
+                py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>())
+        .def("get_distance_idx",      &DistanceMatrix<Distance>::getDistanceIdx, py::arg("vertex1"), py::arg("vertex2"))
+        .def("get_row_idx",           [](const DistanceMatrix<Distance>& self, VertexIndex vertex) {
+                                          const Distance* row = self.getRowIdx(vertex);
+                                          return std::vector<Distance>(row, row+self.getSize());
+                                      }, py::arg("vertex"))
+        .def("get_size",              &DistanceMatrix<Distance>::getSize)
+        .def("is_mapped",             &DistanceMatrix<Distance>::isMapped)
+        .def("write_in_binary_file",  &DistanceMatrix<Distance>::writeInBinaryFile, py::arg("filename"))
+        .def("map_binary_file",       &DistanceMatrix<Distance>::mapBinaryFile, py::arg("filename"))
+        .def_property_readonly_static("UNREACHABLE", [](py::object) { return DistanceMatrix<Distance>::UNREACHABLE; });
+}
+
+
 PYBIND11_MODULE(basegraph, m){
     py::class_<DirectedGraph> (m, "DirectedGraph")
         .def(py::init<size_t>(), py::arg("size"))
@@ -135,13 +167,52 @@ PYBIND11_MODULE(basegraph, m){
     m.def("load_undirected_edgelist_from_text_file", py::overload_cast<std::ifstream&>(&loadUndirectedEdgeListFromTextFile));
 
 
+    // Threads used by the metrics without a thread number argument (0 uses every hardware thread)
+    m.def("set_thread_number", &setThreadNumber, py::arg("thread number"));
+    m.def("get_thread_number", &getThreadNumber);
+
     // General metrics
+    py::enum_<ShortestPathMetric> (m, "ShortestPathMetric", py::arithmetic())
+        .value("CLOSENESS_CENTRALITIES",          CLOSENESS_CENTRALITIES)
+        .value("HARMONIC_CENTRALITIES",           HARMONIC_CENTRALITIES)
+        .value("SHORTEST_PATH_AVERAGES",          SHORTEST_PATH_AVERAGES)
+        .value("SHORTEST_PATH_HARMONIC_AVERAGES", SHORTEST_PATH_HARMONIC_AVERAGES)
+        .value("ECCENTRICITIES",                  ECCENTRICITIES)
+        .value("SHORTEST_PATHS_DISTRIBUTION",     SHORTEST_PATHS_DISTRIBUTION)
+        .value("ALL_SHORTEST_PATH_METRICS",       ALL_SHORTEST_PATH_METRICS)
+        .export_values();
+    py::class_<ShortestPathMetrics> (m, "ShortestPathMetrics")
+        .def_readonly("closeness_centralities",           &ShortestPathMetrics::closenessCentralities)
+        .def_readonly("harmonic_centralities",            &ShortestPathMetrics::harmonicCentralities)
+        .def_readonly("shortest_path_averages",           &ShortestPathMetrics::shortestPathAverages)
+        .def_readonly("shortest_path_harmonic_averages",  &ShortestPathMetrics::shortestPathHarmonicAverages)
+        .def_readonly("eccentricities",                   &ShortestPathMetrics::eccentricities)
+        .def_readonly("shortest_paths_distribution",      &ShortestPathMetrics::shortestPathsDistribution);
+    m.def("get_shortest_path_metrics", &getShortestPathMetrics<DirectedGraph>, py::arg("graph"),
+            py::arg("metrics")=(unsigned int) ALL_SHORTEST_PATH_METRICS, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_shortest_path_metrics", &getShortestPathMetrics<UndirectedGraph>, py::arg("graph"),
+            py::arg("metrics")=(unsigned int) ALL_SHORTEST_PATH_METRICS, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
     m.def("get_closeness_centralities",   py::overload_cast<const DirectedGraph&> (&getClosenessCentralities<DirectedGraph>));
     m.def("get_closeness_centralities",   py::overload_cast<const UndirectedGraph&> (&getClosenessCentralities<UndirectedGraph>));
     m.def("get_harmonic_centralities",    py::overload_cast<const DirectedGraph&> (&getHarmonicCentralities<DirectedGraph>));
     m.def("get_harmonic_centralities",    py::overload_cast<const UndirectedGraph&> (&getHarmonicCentralities<UndirectedGraph>));
-    m.def("get_betweenness_centralities", py::overload_cast<const DirectedGraph&, bool> (&getBetweennessCentralities<DirectedGraph>));
-    m.def("get_betweenness_centralities", py::overload_cast<const UndirectedGraph&, bool> (&getBetweennessCentralities<UndirectedGraph>));
+    m.def("get_betweenness_centralities", py::overload_cast<const DirectedGraph&, bool, size_t> (&getBetweennessCentralities<DirectedGraph>),
+            py::arg("graph"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_betweenness_centralities", py::overload_cast<const UndirectedGraph&, bool, size_t> (&getBetweennessCentralities<UndirectedGraph>),
+            py::arg("graph"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_betweenness_centralities", py::overload_cast<const DirectedGraph&, const std::vector<VertexIndex>&, bool, size_t> (&getBetweennessCentralities<DirectedGraph>),
+            py::arg("graph"), py::arg("sources"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_betweenness_centralities", py::overload_cast<const UndirectedGraph&, const std::vector<VertexIndex>&, bool, size_t> (&getBetweennessCentralities<UndirectedGraph>),
+            py::arg("graph"), py::arg("sources"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_approximate_betweenness_centralities", py::overload_cast<const DirectedGraph&, size_t, size_t> (&getApproximateBetweennessCentralities<DirectedGraph>),
+            py::arg("graph"), py::arg("sample size"), py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_approximate_betweenness_centralities", py::overload_cast<const UndirectedGraph&, size_t, size_t> (&getApproximateBetweennessCentralities<UndirectedGraph>),
+            py::arg("graph"), py::arg("sample size"), py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_betweenness_sample_size", &getBetweennessSampleSize, py::arg("vertices number"), py::arg("epsilon"), py::arg("delta"));
+    m.def("get_edge_betweenness_centralities", py::overload_cast<const DirectedGraph&, bool, size_t> (&getEdgeBetweennessCentralities<DirectedGraph>),
+            py::arg("graph"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("get_edge_betweenness_centralities", py::overload_cast<const UndirectedGraph&, bool, size_t> (&getEdgeBetweennessCentralities<UndirectedGraph>),
+            py::arg("graph"), py::arg("normalize with geodesic number")=true, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
 
 /**/m.def("get_diameters",                       py::overload_cast<const DirectedGraph&> (&getDiameters<DirectedGraph>));
     m.def("get_diameters",                       py::overload_cast<const UndirectedGraph&> (&getDiameters<UndirectedGraph>));
@@ -152,6 +223,28 @@ PYBIND11_MODULE(basegraph, m){
 
 /**/m.def("get_shortest_paths_distribution", py::overload_cast<const DirectedGraph&> (&getShortestPathsDistribution<DirectedGraph>));
 /**/m.def("get_shortest_paths_distribution", py::overload_cast<const UndirectedGraph&> (&getShortestPathsDistribution<UndirectedGraph>));
+    py::class_<ComponentLabels> (m, "ComponentLabels")
+        .def_readonly("labels", &ComponentLabels::labels)
+        .def_readonly("sizes",  &ComponentLabels::sizes)
+        .def("get_component_number", &ComponentLabels::getComponentNumber);
+    m.def("find_connected_component_labels", &findConnectedComponentLabels, py::arg("graph"), py::arg("thread number")=1,
+            py::call_guard<py::gil_scoped_release>());
+    m.def("find_weakly_connected_components", &findWeaklyConnectedComponents, py::arg("graph"), py::arg("thread number")=1,
+            py::call_guard<py::gil_scoped_release>());
+    m.def("find_strongly_connected_components", &findStronglyConnectedComponents, py::arg("graph"), py::arg("thread number")=1,
+            py::call_guard<py::gil_scoped_release>());
+    m.def("get_condensation_graph", &getCondensationGraph, py::arg("graph"), py::arg("components"));
+    py::class_<IncrementalComponents> (m, "IncrementalComponents")
+        .def(py::init<UndirectedGraph&>(), py::arg("graph"), py::keep_alive<1, 2>())
+        .def("add_edge_idx",               py::overload_cast<VertexIndex, VertexIndex, bool>(&IncrementalComponents::addEdgeIdx),
+                                                py::arg("vertex1 index"), py::arg("vertex2 index"), py::arg("force")=false)
+        .def("add_edges_idx",              &IncrementalComponents::addEdgesIdx, py::arg("edges"), py::arg("force")=false)
+        .def("find_root_idx",              &IncrementalComponents::findRootIdx, py::arg("vertex index"))
+        .def("are_connected_idx",          &IncrementalComponents::areConnectedIdx, py::arg("vertex1 index"), py::arg("vertex2 index"))
+        .def("get_component_size_of_idx",  &IncrementalComponents::getComponentSizeOfIdx, py::arg("vertex index"))
+        .def("get_largest_component_size", &IncrementalComponents::getLargestComponentSize)
+        .def("get_component_number",       &IncrementalComponents::getComponentNumber)
+        .def("get_component_labels",       &IncrementalComponents::getComponentLabels);
     m.def("find_connected_components",       py::overload_cast<const DirectedGraph&> (&findConnectedComponents<DirectedGraph>));
     m.def("find_connected_components",       py::overload_cast<const UndirectedGraph&> (&findConnectedComponents<UndirectedGraph>));
 
@@ -160,6 +253,14 @@ PYBIND11_MODULE(basegraph, m){
 /**/m.def("find_all_triangles",                &findAllTriangles);
     m.def("count_triangles_around_vertex_idx", &countTrianglesAroundVertexIdx);
     m.def("count_triangles",                   &countTriangles);
+    py::class_<TriangleCounts> (m, "TriangleCounts")
+        .def_readonly("triangle_number",          &TriangleCounts::triangleNumber)
+        .def_readonly("vertex_triangle_numbers",  &TriangleCounts::vertexTriangleNumbers);
+    py::class_<TriangleEnumerator> (m, "TriangleEnumerator")
+        .def(py::init<const UndirectedGraph&>(), py::arg("graph"))
+        .def("count_triangles",    &TriangleEnumerator::countTriangles, py::arg("thread number")=1,
+                py::call_guard<py::gil_scoped_release>())
+        .def("find_all_triangles", &TriangleEnumerator::findAllTriangles);
 
     m.def("get_local_clustering_coefficients", py::overload_cast<const UndirectedGraph&> (&getLocalClusteringCoefficients));
     m.def("get_global_clustering_coefficient", py::overload_cast<const UndirectedGraph&> (&getGlobalClusteringCoefficient));
@@ -174,6 +275,9 @@ PYBIND11_MODULE(basegraph, m){
 /**/m.def("get_neighbourhood_degrees_of_vertex_idx", &getNeighbourhoodDegreesOfVertexIdx);
 /**/m.def("get_neighbourhood_degree_spectrum", &getNeighbourDegreeSpectrum);
 
+    m.def("get_eccentricities",                &getEccentricities);
+    m.def("get_diameter",                      &getDiameter);
+
     m.def("get_modularity", &getModularity);
 
     // Directed metrics
@@ -195,15 +299,89 @@ PYBIND11_MODULE(basegraph, m){
     m.def("find_shortest_path_lengths_from_vertex_idx", py::overload_cast<const UndirectedGraph&, VertexIndex>(&findShortestPathLengthsFromVertexIdx<UndirectedGraph>));
     m.def("find_geodesics_idx",                 py::overload_cast<const DirectedGraph&, VertexIndex, VertexIndex> (&findGeodesicsIdx<DirectedGraph>));
     m.def("find_geodesics_idx",                 py::overload_cast<const UndirectedGraph&, VertexIndex, VertexIndex> (&findGeodesicsIdx<UndirectedGraph>));
+    m.def("find_geodesics_idx",                 py::overload_cast<const DirectedGraph&, VertexIndex, VertexIndex, const AdjacencyLists&> (&findGeodesicsIdx));
     m.def("find_all_geodesics_idx",             py::overload_cast<const DirectedGraph&, VertexIndex, VertexIndex> (&findAllGeodesicsIdx<DirectedGraph>));
     m.def("find_all_geodesics_idx",             py::overload_cast<const UndirectedGraph&, VertexIndex, VertexIndex> (&findAllGeodesicsIdx<UndirectedGraph>));
     m.def("find_geodesics_from_vertex_idx",     py::overload_cast<const DirectedGraph&, VertexIndex> (&findGeodesicsFromVertexIdx<DirectedGraph>));
     m.def("find_geodesics_from_vertex_idx",     py::overload_cast<const UndirectedGraph&, VertexIndex> (&findGeodesicsFromVertexIdx<UndirectedGraph>));
     m.def("find_all_geodesics_from_vertex_idx", py::overload_cast<const DirectedGraph&, VertexIndex> (&findAllGeodesicsFromVertexIdx<DirectedGraph>));
     m.def("find_all_geodesics_from_vertex_idx", py::overload_cast<const UndirectedGraph&, VertexIndex> (&findAllGeodesicsFromVertexIdx<UndirectedGraph>));
+    m.def("generate_all_geodesics_idx",         py::overload_cast<const DirectedGraph&, VertexIndex, VertexIndex> (&generateAllGeodesicsIdx<DirectedGraph>));
+    m.def("generate_all_geodesics_idx",         py::overload_cast<const UndirectedGraph&, VertexIndex, VertexIndex> (&generateAllGeodesicsIdx<UndirectedGraph>));
+    m.def("count_all_geodesics_idx",            py::overload_cast<const DirectedGraph&, VertexIndex, VertexIndex> (&countAllGeodesicsIdx<DirectedGraph>));
+    m.def("count_all_geodesics_idx",            py::overload_cast<const UndirectedGraph&, VertexIndex, VertexIndex> (&countAllGeodesicsIdx<UndirectedGraph>));
+    m.def("count_all_geodesics_from_vertex_idx", py::overload_cast<const DirectedGraph&, VertexIndex> (&countAllGeodesicsFromVertexIdx<DirectedGraph>));
+    m.def("count_all_geodesics_from_vertex_idx", py::overload_cast<const UndirectedGraph&, VertexIndex> (&countAllGeodesicsFromVertexIdx<UndirectedGraph>));
+
+    py::class_<PredecessorDAG> (m, "PredecessorDAG")
+        .def_readonly("source",       &PredecessorDAG::source)
+        .def_readonly("distances",    &PredecessorDAG::distances)
+        .def_readonly("offsets",      &PredecessorDAG::offsets)
+        .def_readonly("predecessors", &PredecessorDAG::predecessors);
+    m.def("find_predecessor_dag_of_vertex_idx", py::overload_cast<const DirectedGraph&, VertexIndex> (&findPredecessorDAGOfVertexIdx<DirectedGraph>));
+    m.def("find_predecessor_dag_of_vertex_idx", py::overload_cast<const UndirectedGraph&, VertexIndex> (&findPredecessorDAGOfVertexIdx<UndirectedGraph>));
+
+    py::class_<GeodesicGenerator> (m, "GeodesicGenerator")
+        .def("__iter__", [](GeodesicGenerator& self) -> GeodesicGenerator& { return self; })
+        .def("__next__", [](GeodesicGenerator& self) {
+                                if (!self.next())
+                                    throw py::stop_iteration();
+                                return self.getGeodesic();
+                            });
+
+    defineDistanceMatrix<uint8_t>(m, "DistanceMatrix8");
+    defineDistanceMatrix<uint16_t>(m, "DistanceMatrix16");
+
+    py::class_<LandmarkDistanceOracle> landmarkDistanceOracle (m, "LandmarkDistanceOracle");
+    py::enum_<LandmarkDistanceOracle::LandmarkSelection> (landmarkDistanceOracle, "LandmarkSelection")
+        .value("HIGHEST_DEGREE", LandmarkDistanceOracle::HIGHEST_DEGREE)
+        .value("FARTHEST_POINT", LandmarkDistanceOracle::FARTHEST_POINT);
+    landmarkDistanceOracle
+        .def(py::init<>())
+        .def(py::init<const DirectedGraph&, size_t, LandmarkDistanceOracle::LandmarkSelection, size_t>(),
+                py::arg("graph"), py::arg("landmark number"), py::arg("selection")=LandmarkDistanceOracle::HIGHEST_DEGREE,
+                py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>())
+        .def(py::init<const UndirectedGraph&, size_t, LandmarkDistanceOracle::LandmarkSelection, size_t>(),
+                py::arg("graph"), py::arg("landmark number"), py::arg("selection")=LandmarkDistanceOracle::HIGHEST_DEGREE,
+                py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>())
+        .def("get_distance_bounds_idx", &LandmarkDistanceOracle::getDistanceBoundsIdx, py::arg("vertex1"), py::arg("vertex2"))
+        .def("get_lower_bound_idx",     &LandmarkDistanceOracle::getLowerBoundIdx, py::arg("vertex1"), py::arg("vertex2"))
+        .def("get_upper_bound_idx",     &LandmarkDistanceOracle::getUpperBoundIdx, py::arg("vertex1"), py::arg("vertex2"))
+        .def("get_landmarks",           &LandmarkDistanceOracle::getLandmarks)
+        .def("get_size",                &LandmarkDistanceOracle::getSize)
+        .def("is_directed",             &LandmarkDistanceOracle::isDirected)
+        .def("write_in_binary_file",    &LandmarkDistanceOracle::writeInBinaryFile, py::arg("filename"))
+        .def("load_from_binary_file",   &LandmarkDistanceOracle::loadFromBinaryFile, py::arg("filename"));
+
+    py::class_<NeighbourhoodFunction> (m, "NeighbourhoodFunction")
+        .def_readonly("pair_numbers",          &NeighbourhoodFunction::pairNumbers)
+        .def_readonly("harmonic_centralities", &NeighbourhoodFunction::harmonicCentralities)
+        .def("get_distance_distribution",      &NeighbourhoodFunction::getDistanceDistribution)
+        .def("get_average_distance",           &NeighbourhoodFunction::getAverageDistance)
+        .def("get_effective_diameter",         &NeighbourhoodFunction::getEffectiveDiameter, py::arg("fraction")=0.9);
+    m.def("estimate_neighbourhood_function", &estimateNeighbourhoodFunction<DirectedGraph>,
+            py::arg("graph"), py::arg("log2 register number")=7, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+    m.def("estimate_neighbourhood_function", &estimateNeighbourhoodFunction<UndirectedGraph>,
+            py::arg("graph"), py::arg("log2 register number")=7, py::arg("thread number")=1, py::call_guard<py::gil_scoped_release>());
+
+    py::class_<PrunedLandmarkLabeling> (m, "PrunedLandmarkLabeling")
+        .def(py::init<>())
+        .def(py::init<const UndirectedGraph&, size_t>(), py::arg("graph"),
+                py::arg("bit parallel root number")=PrunedLandmarkLabeling::DEFAULT_BIT_PARALLEL_ROOTS,
+                py::call_guard<py::gil_scoped_release>())
+        .def(py::init<const DirectedGraph&>(), py::arg("graph"), py::call_guard<py::gil_scoped_release>())
+        .def("get_distance_idx",             &PrunedLandmarkLabeling::getDistanceIdx, py::arg("vertex1"), py::arg("vertex2"))
+        .def("get_size",                     &PrunedLandmarkLabeling::getSize)
+        .def("is_directed",                  &PrunedLandmarkLabeling::isDirected)
+        .def("is_mapped",                    &PrunedLandmarkLabeling::isMapped)
+        .def("get_bit_parallel_root_number", &PrunedLandmarkLabeling::getBitParallelRootNumber)
+        .def("get_label_entry_number",       &PrunedLandmarkLabeling::getLabelEntryNumber)
+        .def("write_in_binary_file",         &PrunedLandmarkLabeling::writeInBinaryFile, py::arg("filename"))
+        .def("load_from_binary_file",        &PrunedLandmarkLabeling::loadFromBinaryFile, py::arg("filename"))
+        .def("map_binary_file",              &PrunedLandmarkLabeling::mapBinaryFile, py::arg("filename"));
 
     // Random graphs
-    //m.def("seed_rng", [&rng](size_t seed) { rng.seed(seed); });
+    m.def("seed_rng", [](size_t seed) { rng.seed(seed); });
     m.def("generate_erdos_renyi_graph",             &generateErdosRenyiGraph);
     m.def("generate_sparse_erdos_renyi_graph",      &generateSparseErdosRenyiGraph);
     m.def("generate_graph_with_degree_distribution_stub_matching", &generateGraphWithDegreeDistributionStubMatching);
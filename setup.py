@@ -34,8 +34,16 @@ ext_modules = [
                  "src/directedgraph.cpp",
                  "src/undirectedgraph.cpp",
                  "src/fileio.cpp",
+                 "src/perfecthash.cpp",
 
                  "src/algorithms/graphpaths.cpp",
+                 "src/algorithms/breadthfirstsearch.cpp",
+                 "src/algorithms/components.cpp",
+                 "src/algorithms/distancematrix.cpp",
+                 "src/algorithms/distanceoracle.cpp",
+                 "src/algorithms/hyperanf.cpp",
+                 "src/algorithms/prunedlandmarklabeling.cpp",
+                 "src/algorithms/triangles.cpp",
                  "src/algorithms/percolation.cpp",
                  "src/algorithms/randomgraphs.cpp",
                  "src/algorithms/layeredconfigurationmodel.cpp",
@@ -83,11 +91,11 @@ class BuildExt(build_ext):
     """A custom build extension for adding compiler-specific options."""
     c_opts = {
         'msvc': ['/EHsc'],
-        'unix': [],
+        'unix': ['-pthread'],
     }
     l_opts = {
         'msvc': [],
-        'unix': [],
+        'unix': ['-pthread'],
     }
 
     if sys.platform == 'darwin':
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "BaseGraph/undirectedgraph.h"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+template <typename T>
+void BreadthFirstSearch<T>::run(VertexIndex source) {
+    size_t verticesNumber = graph.getSize();
+    if (source >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(source) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+
+    reset(source);
+    size_t unexploredEdges = edgesNumber;
+    size_t frontierEdges = graph.getOutEdgesOfIdx(source).size();
+
+    size_t depth = 0;
+    while (!frontier.empty()) {
+        if (frontierEdges > unexploredEdges/ALPHA) {
+            if (inEdgesOffsets.size() != verticesNumber+1)
+                buildInEdges();
+
+            frontierBitmap.assign((verticesNumber+63)/64, 0);
+            for (VertexIndex vertex: frontier)
+                addToBitmap(frontierBitmap, vertex);
+
+            // The edges leaving each frontier are counted as explored, as in the
+            // top-down steps. Each frontier is made of the last visited vertices.
+            size_t frontierSize = frontier.size(), previousFrontierSize;
+            do {
+                unexploredEdges -= min(unexploredEdges, frontierEdges);
+                previousFrontierSize = frontierSize;
+                frontierSize = bottomUpStep(depth++);
+                frontierBitmap.swap(nextFrontierBitmap);
+
+                frontierEdges = 0;
+                for (auto vertex=visitedVertices.end()-frontierSize; vertex!=visitedVertices.end(); vertex++)
+                    frontierEdges += graph.getOutEdgesOfIdx(*vertex).size();
+            } while (frontierSize >= previousFrontierSize || frontierSize > verticesNumber/BETA);
+
+            frontier.assign(visitedVertices.end()-frontierSize, visitedVertices.end());
+        }
+        else {
+            unexploredEdges -= min(unexploredEdges, frontierEdges);
+            frontierEdges = topDownStep(depth++);
+        }
+    }
+}
+
+template <typename T>
+void BreadthFirstSearch<T>::runBidirectional(VertexIndex source, VertexIndex destination) {
+    size_t verticesNumber = graph.getSize();
+    if (source >= verticesNumber || destination >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(max(source, destination)) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+
+    reset(source);
+    resetBackward(destination);
+    if (!is_same<T, UndirectedGraph>::value && inEdgesOffsets.size() != verticesNumber+1)
+        buildInEdges();
+
+    meetingVertex = source == destination ? source : SIZE_T_MAX;
+    size_t pathLength = SIZE_T_MAX, forwardDepth = 0, backwardDepth = 0;
+    while (meetingVertex == SIZE_T_MAX && !frontier.empty() && !backwardFrontier.empty()) {
+        if (frontier.size() <= backwardFrontier.size())
+            expandBidirectionalLevel(true, forwardDepth++, pathLength);
+        else
+            expandBidirectionalLevel(false, backwardDepth++, pathLength);
+    }
+}
+
+// Every meeting of the level is checked to keep the shortest path
+template <typename T>
+void BreadthFirstSearch<T>::expandBidirectionalLevel(bool forward, size_t depth, size_t& pathLength) {
+    vector<size_t>& sideDistances = forward ? distances : backwardDistances;
+    vector<VertexIndex>& parents = forward ? predecessors : successors;
+    vector<VertexIndex>& sideVisitedVertices = forward ? visitedVertices : backwardVisitedVertices;
+    vector<VertexIndex>& sideFrontier = forward ? frontier : backwardFrontier;
+    const vector<size_t>& otherDistances = forward ? backwardDistances : distances;
+
+    nextFrontier.clear();
+    auto visit = [&](VertexIndex vertex, VertexIndex neighbour) {
+        if (sideDistances[neighbour] != SIZE_T_MAX)
+            return;
+        sideDistances[neighbour] = depth+1;
+        parents[neighbour] = vertex;
+        nextFrontier.push_back(neighbour);
+        sideVisitedVertices.push_back(neighbour);
+
+        size_t otherDistance = otherDistances[neighbour];
+        if (otherDistance != SIZE_T_MAX && depth+1+otherDistance < pathLength) {
+            pathLength = depth+1+otherDistance;
+            meetingVertex = neighbour;
+        }
+    };
+
+    // The in edges of an undirected graph are its edges
+    for (VertexIndex vertex: sideFrontier) {
+        if (forward || is_same<T, UndirectedGraph>::value)
+            for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                visit(vertex, neighbour);
+        else
+            for (size_t i=inEdgesOffsets[vertex]; i<inEdgesOffsets[vertex+1]; i++)
+                visit(vertex, inEdges[i]);
+    }
+    sideFrontier.swap(nextFrontier);
+}
+
+template <typename T>
+void BreadthFirstSearch<T>::reset(VertexIndex source) {
+    size_t verticesNumber = graph.getSize();
+
+    if (distances.size() != verticesNumber) {
+        distances.assign(verticesNumber, SIZE_T_MAX);
+        predecessors.assign(verticesNumber, SIZE_T_MAX);
+        inEdgesOffsets.clear();
+
+        edgesNumber = 0;
+        for (VertexIndex vertex: graph)
+            edgesNumber += graph.getOutEdgesOfIdx(vertex).size();
+    }
+    else {
+        for (VertexIndex vertex: visitedVertices) {
+            distances[vertex] = SIZE_T_MAX;
+            predecessors[vertex] = SIZE_T_MAX;
+        }
+    }
+
+    distances[source] = 0;
+    visitedVertices.assign(1, source);
+    frontier.assign(1, source);
+}
+
+template <typename T>
+void BreadthFirstSearch<T>::resetBackward(VertexIndex destination) {
+    size_t verticesNumber = graph.getSize();
+
+    if (backwardDistances.size() != verticesNumber) {
+        backwardDistances.assign(verticesNumber, SIZE_T_MAX);
+        successors.assign(verticesNumber, SIZE_T_MAX);
+    }
+    else {
+        for (VertexIndex vertex: backwardVisitedVertices) {
+            backwardDistances[vertex] = SIZE_T_MAX;
+            successors[vertex] = SIZE_T_MAX;
+        }
+    }
+
+    backwardDistances[destination] = 0;
+    backwardVisitedVertices.assign(1, destination);
+    backwardFrontier.assign(1, destination);
+}
+
+// Returns the number of edges leaving the next frontier
+template <typename T>
+size_t BreadthFirstSearch<T>::topDownStep(size_t depth) {
+    size_t nextFrontierEdges = 0;
+    nextFrontier.clear();
+
+    for (VertexIndex vertex: frontier) {
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == SIZE_T_MAX) {
+                distances[neighbour] = depth+1;
+                predecessors[neighbour] = vertex;
+                nextFrontier.push_back(neighbour);
+                visitedVertices.push_back(neighbour);
+                nextFrontierEdges += graph.getOutEdgesOfIdx(neighbour).size();
+            }
+        }
+    }
+    frontier.swap(nextFrontier);
+    return nextFrontierEdges;
+}
+
+// Returns the number of vertices in the next frontier
+template <typename T>
+size_t BreadthFirstSearch<T>::bottomUpStep(size_t depth) {
+    size_t nextFrontierSize = 0;
+    size_t verticesNumber = graph.getSize();
+    nextFrontierBitmap.assign(frontierBitmap.size(), 0);
+
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++) {
+        if (distances[vertex] != SIZE_T_MAX)
+            continue;
+
+        for (size_t i=inEdgesOffsets[vertex]; i<inEdgesOffsets[vertex+1]; i++) {
+            VertexIndex parent = inEdges[i];
+            if (isInBitmap(frontierBitmap, parent)) {
+                distances[vertex] = depth+1;
+                predecessors[vertex] = parent;
+                addToBitmap(nextFrontierBitmap, vertex);
+                visitedVertices.push_back(vertex);
+                nextFrontierSize++;
+                break;
+            }
+        }
+    }
+    return nextFrontierSize;
+}
+
+template <typename T>
+void BreadthFirstSearch<T>::buildInEdges() {
+    size_t verticesNumber = graph.getSize();
+    inEdgesOffsets.assign(verticesNumber+1, 0);
+
+    for (VertexIndex vertex: graph)
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            inEdgesOffsets[neighbour+1]++;
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+        inEdgesOffsets[vertex+1] += inEdgesOffsets[vertex];
+
+    inEdges.resize(inEdgesOffsets[verticesNumber]);
+    vector<size_t> insertPositions(inEdgesOffsets.begin(), inEdgesOffsets.end()-1);
+    for (VertexIndex vertex: graph)
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            inEdges[insertPositions[neighbour]++] = vertex;
+}
+
+
+// Allowed classes
+
+template class BreadthFirstSearch<DirectedGraph>;
+template class BreadthFirstSearch<UndirectedGraph>;
+
+} // namespace BaseGraph
@@ -0,0 +1,506 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BaseGraph/algorithms/components.h"
+#include "BaseGraph/parallel.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+static ComponentLabels labelComponentsBySearch(const UndirectedGraph& graph) {
+    size_t verticesNumber = graph.getSize();
+    ComponentLabels components;
+    components.labels.assign(verticesNumber, SIZE_T_MAX);
+
+    vector<VertexIndex> stack;
+    for (VertexIndex startVertex: graph) {
+        if (components.labels[startVertex] != SIZE_T_MAX)
+            continue;
+
+        size_t label = components.sizes.size();
+        size_t size = 0;
+        components.labels[startVertex] = label;
+        stack.assign(1, startVertex);
+        while (!stack.empty()) {
+            VertexIndex vertex = stack.back();
+            stack.pop_back();
+            size++;
+            for (const VertexIndex& neighbour: graph.getNeighboursOfIdx(vertex)) {
+                if (components.labels[neighbour] == SIZE_T_MAX) {
+                    components.labels[neighbour] = label;
+                    stack.push_back(neighbour);
+                }
+            }
+        }
+        components.sizes.push_back(size);
+    }
+    return components;
+}
+
+
+// Concurrent union-find in which a root only gets linked to a smaller root, so that
+// parents[v] <= v and the root of a component is its smallest vertex.
+class ConcurrentUnionFind {
+    public:
+        explicit ConcurrentUnionFind(size_t size): parents(size) {
+            for (size_t i=0; i<size; i++)
+                parents[i].store(i, memory_order_relaxed);
+        }
+
+        // Path halving: every visited vertex is pointed to its grandparent
+        size_t find(size_t vertex) {
+            while (true) {
+                size_t parent = parents[vertex].load(memory_order_relaxed);
+                if (parent == vertex)
+                    return vertex;
+                size_t grandparent = parents[parent].load(memory_order_relaxed);
+                if (grandparent != parent)
+                    parents[vertex].compare_exchange_weak(parent, grandparent, memory_order_relaxed);
+                vertex = grandparent;
+            }
+        }
+
+        void link(size_t vertex1, size_t vertex2) {
+            while (true) {
+                size_t root1 = find(vertex1), root2 = find(vertex2);
+                if (root1 == root2)
+                    return;
+                size_t largerRoot = root1 > root2 ? root1 : root2;
+                size_t smallerRoot = root1 > root2 ? root2 : root1;
+                // Fails if largerRoot was linked by another thread in the meantime
+                if (parents[largerRoot].compare_exchange_strong(largerRoot, smallerRoot, memory_order_relaxed))
+                    return;
+            }
+        }
+
+    private:
+        vector<atomic<size_t>> parents;
+};
+
+// Roots are the smallest vertices of their component, hence are met in label order
+static ComponentLabels getLabelsOfUnionFind(ConcurrentUnionFind& unionFind, size_t verticesNumber) {
+    ComponentLabels components;
+    components.labels.resize(verticesNumber);
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++) {
+        size_t root = unionFind.find(vertex);
+        if (root == vertex) {
+            components.labels[vertex] = components.sizes.size();
+            components.sizes.push_back(0);
+        }
+        else
+            components.labels[vertex] = components.labels[root];
+        components.sizes[components.labels[vertex]]++;
+    }
+    return components;
+}
+
+static ComponentLabels labelComponentsByAfforest(const UndirectedGraph& graph, size_t threadNumber) {
+    const size_t NEIGHBOUR_ROUNDS = 2;
+    const size_t SAMPLE_SIZE = 1024;
+    size_t verticesNumber = graph.getSize();
+    ConcurrentUnionFind unionFind(verticesNumber);
+
+    // Links along the first neighbours, which usually connect most of the largest component
+    parallelForDynamic(0, verticesNumber, [&](VertexIndex vertex) {
+        size_t round = 0;
+        for (auto neighbour=graph.getNeighboursOfIdx(vertex).begin();
+                neighbour!=graph.getNeighboursOfIdx(vertex).end() && round<NEIGHBOUR_ROUNDS; ++neighbour, round++)
+            unionFind.link(vertex, *neighbour);
+    }, threadNumber, 1024);
+
+    // The most frequent root among evenly spaced vertices
+    unordered_map<size_t, size_t> rootFrequencies;
+    size_t stride = verticesNumber > SAMPLE_SIZE ? verticesNumber/SAMPLE_SIZE : 1;
+    size_t largestRoot = 0, largestFrequency = 0;
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex+=stride) {
+        size_t frequency = ++rootFrequencies[unionFind.find(vertex)];
+        if (frequency > largestFrequency) {
+            largestFrequency = frequency;
+            largestRoot = unionFind.find(vertex);
+        }
+    }
+
+    // An edge skipped at one of its ends is linked from the other, unless both ends
+    // are already in the largest component
+    parallelForDynamic(0, verticesNumber, [&](VertexIndex vertex) {
+        if (unionFind.find(vertex) == largestRoot)
+            return;
+        size_t round = 0;
+        for (const VertexIndex& neighbour: graph.getNeighboursOfIdx(vertex))
+            if (round++ >= NEIGHBOUR_ROUNDS)
+                unionFind.link(vertex, neighbour);
+    }, threadNumber, 1024);
+
+    return getLabelsOfUnionFind(unionFind, verticesNumber);
+}
+
+ComponentLabels findConnectedComponentLabels(const UndirectedGraph& graph, size_t threadNumber) {
+    if (threadNumber == 1)
+        return labelComponentsBySearch(graph);
+    return labelComponentsByAfforest(graph, threadNumber);
+}
+
+ComponentLabels findWeaklyConnectedComponents(const DirectedGraph& graph, size_t threadNumber) {
+    size_t verticesNumber = graph.getSize();
+    ConcurrentUnionFind unionFind(verticesNumber);
+    parallelForDynamic(0, verticesNumber, [&](VertexIndex vertex) {
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            unionFind.link(vertex, neighbour);
+    }, threadNumber, 1024);
+    return getLabelsOfUnionFind(unionFind, verticesNumber);
+}
+
+
+// componentIds[v] identifies the component of v among componentNumber ids
+static ComponentLabels getLabelsOrderedBySmallestVertex(const vector<size_t>& componentIds, size_t componentNumber) {
+    ComponentLabels components;
+    components.labels.resize(componentIds.size());
+    vector<size_t> labelOfIds(componentNumber, SIZE_T_MAX);
+    for (VertexIndex vertex=0; vertex<componentIds.size(); vertex++) {
+        size_t& label = labelOfIds[componentIds[vertex]];
+        if (label == SIZE_T_MAX) {
+            label = components.sizes.size();
+            components.sizes.push_back(0);
+        }
+        components.labels[vertex] = label;
+        components.sizes[label]++;
+    }
+    return components;
+}
+
+static ComponentLabels findStronglyConnectedComponentsByTarjan(const DirectedGraph& graph) {
+    size_t verticesNumber = graph.getSize();
+    vector<size_t> indices(verticesNumber, SIZE_T_MAX), lowLinks(verticesNumber);
+    vector<size_t> componentIds(verticesNumber, SIZE_T_MAX);
+    vector<VertexIndex> componentStack;
+    // Search path, with the next out edge to explore from each vertex
+    vector<pair<VertexIndex, Successors::const_iterator>> path;
+    size_t index = 0, componentNumber = 0;
+
+    for (VertexIndex root: graph) {
+        if (indices[root] != SIZE_T_MAX)
+            continue;
+
+        indices[root] = lowLinks[root] = index++;
+        componentStack.push_back(root);
+        path.push_back({root, graph.getOutEdgesOfIdx(root).begin()});
+
+        while (!path.empty()) {
+            VertexIndex vertex = path.back().first;
+            auto& neighbour = path.back().second;
+
+            bool descended = false;
+            while (!descended && neighbour != graph.getOutEdgesOfIdx(vertex).end()) {
+                VertexIndex next = *neighbour++;
+                if (indices[next] == SIZE_T_MAX) {
+                    indices[next] = lowLinks[next] = index++;
+                    componentStack.push_back(next);
+                    path.push_back({next, graph.getOutEdgesOfIdx(next).begin()});
+                    descended = true;
+                }
+                // A vertex with an index is on the stack unless its component is closed
+                else if (componentIds[next] == SIZE_T_MAX)
+                    lowLinks[vertex] = min(lowLinks[vertex], indices[next]);
+            }
+            if (descended)
+                continue;
+
+            if (lowLinks[vertex] == indices[vertex]) {
+                VertexIndex member;
+                do {
+                    member = componentStack.back();
+                    componentStack.pop_back();
+                    componentIds[member] = componentNumber;
+                } while (member != vertex);
+                componentNumber++;
+            }
+            path.pop_back();
+            if (!path.empty())
+                lowLinks[path.back().first] = min(lowLinks[path.back().first], lowLinks[vertex]);
+        }
+    }
+    return getLabelsOrderedBySmallestVertex(componentIds, componentNumber);
+}
+
+
+// Vertices of a forward-backward subproblem, which all have the color of the task
+struct ForwardBackwardTask {
+    size_t color;
+    vector<VertexIndex> vertices;
+};
+
+class ForwardBackwardSearch {
+    public:
+        ForwardBackwardSearch(const DirectedGraph& graph): graph(graph), verticesNumber(graph.getSize()),
+                colors(verticesNumber), componentIds(verticesNumber, SIZE_T_MAX) {
+            inOffsets.assign(verticesNumber+1, 0);
+            for (VertexIndex vertex: graph)
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    inOffsets[neighbour+1]++;
+            for (VertexIndex vertex: graph)
+                inOffsets[vertex+1] += inOffsets[vertex];
+            inEdges.resize(inOffsets[verticesNumber]);
+            vector<size_t> positions(inOffsets.begin(), inOffsets.end()-1);
+            for (VertexIndex vertex: graph)
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    inEdges[positions[neighbour]++] = vertex;
+        }
+
+        ComponentLabels run(size_t threadNumber) {
+            tasks.push_back(trim());
+            if (tasks.back().vertices.empty())
+                tasks.clear();
+
+            if (threadNumber == 0)
+                threadNumber = getHardwareThreadNumber();
+            parallelFor(0, threadNumber, [&](size_t) { processTasks(); }, threadNumber);
+
+            // The component ids are the vertices used as pivots
+            return getLabelsOrderedBySmallestVertex(componentIds, verticesNumber);
+        }
+
+    private:
+        static const size_t TRIMMED = SIZE_T_MAX;
+
+        const DirectedGraph& graph;
+        size_t verticesNumber;
+        vector<size_t> inOffsets;
+        vector<VertexIndex> inEdges;
+
+        vector<atomic<size_t>> colors;
+        vector<size_t> componentIds;
+        atomic<size_t> nextColor{1};
+
+        vector<ForwardBackwardTask> tasks;
+        size_t activeThreadNumber = 0;
+        mutex tasksMutex;
+        condition_variable tasksCondition;
+
+        // Removes the vertices without in or out edges among the remaining vertices,
+        // which are components by themselves. Returns the first task.
+        ForwardBackwardTask trim() {
+            vector<size_t> inDegrees(verticesNumber, 0), outDegrees(verticesNumber, 0);
+            for (VertexIndex vertex: graph)
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    if (neighbour != vertex) {
+                        outDegrees[vertex]++;
+                        inDegrees[neighbour]++;
+                    }
+
+            vector<VertexIndex> trimmedVertices;
+            for (VertexIndex vertex: graph) {
+                colors[vertex].store(0, memory_order_relaxed);
+                if (inDegrees[vertex] == 0 || outDegrees[vertex] == 0) {
+                    colors[vertex].store(TRIMMED, memory_order_relaxed);
+                    trimmedVertices.push_back(vertex);
+                }
+            }
+            for (size_t i=0; i<trimmedVertices.size(); i++) {
+                VertexIndex vertex = trimmedVertices[i];
+                componentIds[vertex] = vertex;
+                auto trimNeighbour = [&](VertexIndex neighbour, vector<size_t>& degrees) {
+                    if (neighbour != vertex && colors[neighbour].load(memory_order_relaxed) != TRIMMED && --degrees[neighbour] == 0) {
+                        colors[neighbour].store(TRIMMED, memory_order_relaxed);
+                        trimmedVertices.push_back(neighbour);
+                    }
+                };
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    trimNeighbour(neighbour, inDegrees);
+                for (size_t j=inOffsets[vertex]; j<inOffsets[vertex+1]; j++)
+                    trimNeighbour(inEdges[j], outDegrees);
+            }
+
+            ForwardBackwardTask task = {0, {}};
+            for (VertexIndex vertex: graph)
+                if (colors[vertex].load(memory_order_relaxed) == 0)
+                    task.vertices.push_back(vertex);
+            return task;
+        }
+
+        void processTasks() {
+            unique_lock<mutex> lock(tasksMutex);
+            while (true) {
+                tasksCondition.wait(lock, [&]() { return !tasks.empty() || activeThreadNumber == 0; });
+                if (tasks.empty())
+                    break;
+
+                ForwardBackwardTask task = move(tasks.back());
+                tasks.pop_back();
+                activeThreadNumber++;
+                lock.unlock();
+
+                vector<ForwardBackwardTask> subtasks;
+                try {
+                    subtasks = split(task);
+                } catch (...) {
+                    lock.lock();
+                    activeThreadNumber--;
+                    tasks.clear();
+                    tasksCondition.notify_all();
+                    throw;
+                }
+
+                lock.lock();
+                activeThreadNumber--;
+                for (auto& subtask: subtasks)
+                    tasks.push_back(move(subtask));
+                tasksCondition.notify_all();
+            }
+        }
+
+        // Colors the vertices reached from the pivot, then the vertices reaching it.
+        // The other tasks only read the colors of these vertices, which never match theirs.
+        vector<ForwardBackwardTask> split(const ForwardBackwardTask& task) {
+            VertexIndex pivot = task.vertices[0];
+            if (task.vertices.size() == 1) {
+                componentIds[pivot] = pivot;
+                return {};
+            }
+            size_t forwardColor = nextColor++, componentColor = nextColor++, backwardColor = nextColor++;
+
+            vector<VertexIndex> queue(1, pivot);
+            colors[pivot].store(forwardColor, memory_order_relaxed);
+            for (size_t i=0; i<queue.size(); i++)
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(queue[i]))
+                    if (colors[neighbour].load(memory_order_relaxed) == task.color) {
+                        colors[neighbour].store(forwardColor, memory_order_relaxed);
+                        queue.push_back(neighbour);
+                    }
+
+            queue.assign(1, pivot);
+            colors[pivot].store(componentColor, memory_order_relaxed);
+            for (size_t i=0; i<queue.size(); i++)
+                for (size_t j=inOffsets[queue[i]]; j<inOffsets[queue[i]+1]; j++) {
+                    VertexIndex neighbour = inEdges[j];
+                    size_t color = colors[neighbour].load(memory_order_relaxed);
+                    if (color == forwardColor || color == task.color) {
+                        colors[neighbour].store(color == forwardColor ? componentColor : backwardColor, memory_order_relaxed);
+                        queue.push_back(neighbour);
+                    }
+                }
+
+            vector<ForwardBackwardTask> subtasks = {{forwardColor, {}}, {backwardColor, {}}, {task.color, {}}};
+            for (VertexIndex vertex: task.vertices) {
+                size_t color = colors[vertex].load(memory_order_relaxed);
+                if (color == componentColor)
+                    componentIds[vertex] = pivot;
+                else
+                    subtasks[color == forwardColor ? 0 : color == backwardColor ? 1 : 2].vertices.push_back(vertex);
+            }
+            subtasks.erase(remove_if(subtasks.begin(), subtasks.end(),
+                        [](const ForwardBackwardTask& subtask) { return subtask.vertices.empty(); }), subtasks.end());
+            return subtasks;
+        }
+};
+
+ComponentLabels findStronglyConnectedComponents(const DirectedGraph& graph, size_t threadNumber) {
+    if (threadNumber == 1)
+        return findStronglyConnectedComponentsByTarjan(graph);
+    return ForwardBackwardSearch(graph).run(threadNumber);
+}
+
+DirectedGraph getCondensationGraph(const DirectedGraph& graph, const ComponentLabels& components) {
+    if (components.labels.size() != graph.getSize())
+        throw logic_error("The component labels must have the size of the graph.");
+
+    vector<Edge> edges;
+    for (VertexIndex vertex: graph)
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            if (components.labels[vertex] != components.labels[neighbour])
+                edges.push_back({components.labels[vertex], components.labels[neighbour]});
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+
+    DirectedGraph condensationGraph(components.getComponentNumber());
+    for (const Edge& edge: edges)
+        condensationGraph.addEdgeIdx(edge, true);
+    return condensationGraph;
+}
+
+
+
+IncrementalComponents::IncrementalComponents(UndirectedGraph& graph): graph(graph) {
+    addNewVertices();
+    for (VertexIndex vertex: graph)
+        for (const VertexIndex& neighbour: graph.getNeighboursOfIdx(vertex))
+            if (vertex < neighbour)
+                merge(vertex, neighbour);
+}
+
+void IncrementalComponents::addNewVertices() {
+    size_t previousSize = parents.size();
+    if (graph.getSize() <= previousSize)
+        return;
+
+    parents.resize(graph.getSize());
+    sizes.resize(graph.getSize(), 1);
+    for (VertexIndex vertex=previousSize; vertex<parents.size(); vertex++)
+        parents[vertex] = vertex;
+    componentNumber += graph.getSize()-previousSize;
+    largestComponentSize = max(largestComponentSize, (size_t) 1);
+}
+
+VertexIndex IncrementalComponents::findRootIdx(VertexIndex vertex) {
+    if (vertex >= parents.size()) {
+        addNewVertices();
+        if (vertex >= parents.size())
+            throw out_of_range("Vertex index (" + to_string(vertex) +
+                    ") greater than the graph's size("+ to_string(parents.size()) +").");
+    }
+    while (parents[vertex] != vertex) {
+        parents[vertex] = parents[parents[vertex]];
+        vertex = parents[vertex];
+    }
+    return vertex;
+}
+
+void IncrementalComponents::merge(VertexIndex vertex1, VertexIndex vertex2) {
+    VertexIndex root1 = findRootIdx(vertex1), root2 = findRootIdx(vertex2);
+    if (root1 == root2)
+        return;
+    if (sizes[root1] < sizes[root2])
+        swap(root1, root2);
+
+    parents[root2] = root1;
+    sizes[root1] += sizes[root2];
+    largestComponentSize = max(largestComponentSize, sizes[root1]);
+    componentNumber--;
+}
+
+void IncrementalComponents::addEdgeIdx(VertexIndex vertex1, VertexIndex vertex2, bool force) {
+    addNewVertices();
+    graph.addEdgeIdx(vertex1, vertex2, force);
+    merge(vertex1, vertex2);
+}
+
+vector<size_t> IncrementalComponents::addEdgesIdx(const vector<Edge>& edges, bool force) {
+    addNewVertices();
+    vector<size_t> largestComponentSizes;
+    largestComponentSizes.reserve(edges.size());
+    for (const Edge& edge: edges) {
+        graph.addEdgeIdx(edge, force);
+        merge(edge.first, edge.second);
+        largestComponentSizes.push_back(largestComponentSize);
+    }
+    return largestComponentSizes;
+}
+
+ComponentLabels IncrementalComponents::getComponentLabels() {
+    addNewVertices();
+    vector<size_t> roots(parents.size());
+    for (VertexIndex vertex=0; vertex<parents.size(); vertex++)
+        roots[vertex] = findRootIdx(vertex);
+    return getLabelsOrderedBySmallestVertex(roots, parents.size());
+}
+
+} // namespace BaseGraph
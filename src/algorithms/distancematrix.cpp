@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "BaseGraph/algorithms/distancematrix.h"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
+#include "BaseGraph/binarystream.hpp"
+#include "BaseGraph/parallel.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+static const char DISTANCE_MATRIX_FILE_TAG[16] = "BaseGraphDist1";
+
+template <typename Distance>
+const Distance DistanceMatrix<Distance>::UNREACHABLE;
+
+
+template <typename Distance>
+DistanceMatrix<Distance>::DistanceMatrix(const DirectedGraph& graph, size_t threadNumber): verticesNumber(graph.getSize()) {
+    distances.resize(verticesNumber*verticesNumber);
+    computeRows(graph, distances.data(), threadNumber);
+}
+
+template <typename Distance>
+DistanceMatrix<Distance>::DistanceMatrix(const UndirectedGraph& graph, size_t threadNumber): verticesNumber(graph.getSize()) {
+    distances.resize(verticesNumber*verticesNumber);
+    computeRows(graph, distances.data(), threadNumber);
+}
+
+template <typename Distance>
+DistanceMatrix<Distance>::DistanceMatrix(const DirectedGraph& graph, const string& fileName, size_t threadNumber):
+        verticesNumber(graph.getSize()) {
+    computeRowsInFile(graph, fileName, threadNumber);
+}
+
+template <typename Distance>
+DistanceMatrix<Distance>::DistanceMatrix(const UndirectedGraph& graph, const string& fileName, size_t threadNumber):
+        verticesNumber(graph.getSize()) {
+    computeRowsInFile(graph, fileName, threadNumber);
+}
+
+template <typename Distance>
+template <typename T>
+void DistanceMatrix<Distance>::computeRowsInFile(const T& graph, const string& fileName, size_t threadNumber) {
+    mapping = MappedFile::create(fileName, sizeof(Header) + verticesNumber*verticesNumber*sizeof(Distance));
+    Header header = getHeader();
+    memcpy(mapping.getData(), &header, sizeof(Header));
+    computeRows(graph, (Distance*) ((char*) mapping.getData() + sizeof(Header)), threadNumber);
+}
+
+// The sources are split in one contiguous chunk per thread, so that each thread
+// writes contiguous rows.
+template <typename Distance>
+template <typename T>
+void DistanceMatrix<Distance>::computeRows(const T& graph, Distance* rows, size_t threadNumber) {
+    if (verticesNumber == 0)
+        return;
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    size_t chunkNumber = min(threadNumber, verticesNumber);
+
+    parallelFor(0, chunkNumber, [&](size_t chunk) {
+        BreadthFirstSearch<T> workspace(graph);
+        for (VertexIndex source=chunk*verticesNumber/chunkNumber; source<(chunk+1)*verticesNumber/chunkNumber; source++) {
+            workspace.run(source);
+            Distance* row = rows + source*verticesNumber;
+            fill(row, row+verticesNumber, UNREACHABLE);
+
+            // The vertices are visited by increasing distance
+            if (workspace.getDistances()[workspace.getVisitedVertices().back()] >= UNREACHABLE)
+                throw overflow_error("Distance " + to_string(workspace.getDistances()[workspace.getVisitedVertices().back()])
+                        + " does not fit in the distance matrix.");
+            for (VertexIndex vertex: workspace.getVisitedVertices())
+                row[vertex] = workspace.getDistances()[vertex];
+        }
+    }, chunkNumber);
+}
+
+template <typename Distance>
+typename DistanceMatrix<Distance>::Header DistanceMatrix<Distance>::getHeader() const {
+    Header header;
+    memcpy(header.tag, DISTANCE_MATRIX_FILE_TAG, sizeof(header.tag));
+    header.verticesNumber = verticesNumber;
+    header.distanceSize = sizeof(Distance);
+    return header;
+}
+
+template <typename Distance>
+void DistanceMatrix<Distance>::assertVertexInRange(VertexIndex vertex) const {
+    if (vertex >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(vertex) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+}
+
+template <typename Distance>
+size_t DistanceMatrix<Distance>::getDistanceIdx(VertexIndex vertex1, VertexIndex vertex2) const {
+    assertVertexInRange(vertex1);
+    assertVertexInRange(vertex2);
+    Distance distance = getData()[vertex1*verticesNumber+vertex2];
+    return distance == UNREACHABLE ? SIZE_T_MAX : distance;
+}
+
+template <typename Distance>
+const Distance* DistanceMatrix<Distance>::getRowIdx(VertexIndex vertex) const {
+    assertVertexInRange(vertex);
+    return getData() + vertex*verticesNumber;
+}
+
+template <typename Distance>
+void DistanceMatrix<Distance>::writeInBinaryFile(const string& fileName) const {
+    ofstream fileStream(fileName, ios::binary);
+    if (!fileStream.is_open())
+        throw runtime_error("Could not open file.");
+    Header header = getHeader();
+    fileStream.write((const char*) &header, sizeof(Header));
+    fileStream.write((const char*) getData(), verticesNumber*verticesNumber*sizeof(Distance));
+}
+
+template <typename Distance>
+void DistanceMatrix<Distance>::mapBinaryFile(const string& fileName) {
+    MappedFile fileMapping = MappedFile::openReadOnly(fileName);
+    if (fileMapping.getSize() < sizeof(Header))
+        throw runtime_error("File does not contain a distance matrix.");
+
+    Header header;
+    memcpy(&header, fileMapping.getData(), sizeof(Header));
+    if (strncmp(header.tag, DISTANCE_MATRIX_FILE_TAG, sizeof(header.tag)) != 0)
+        throw runtime_error("File does not contain a distance matrix.");
+    if (header.distanceSize != sizeof(Distance))
+        throw runtime_error("The distance matrix has distances of " + to_string(header.distanceSize) + " bytes.");
+    // The products are checked for overflow before comparing with the file size
+    uint64_t matrixSize = fileMapping.getSize()-sizeof(Header), fileVerticesNumber = header.verticesNumber;
+    if (!fitsInRemainingSize(fileVerticesNumber, sizeof(Distance), matrixSize)
+            || !fitsInRemainingSize(fileVerticesNumber, fileVerticesNumber*sizeof(Distance), matrixSize)
+            || fileVerticesNumber*fileVerticesNumber*sizeof(Distance) != matrixSize)
+        throw runtime_error("Corrupted distance matrix.");
+
+    verticesNumber = header.verticesNumber;
+    distances.clear();
+    distances.shrink_to_fit();
+    mapping = move(fileMapping);
+}
+
+
+template class DistanceMatrix<uint8_t>;
+template class DistanceMatrix<uint16_t>;
+
+} // namespace BaseGraph
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "BaseGraph/algorithms/distanceoracle.h"
+#include "BaseGraph/binarystream.hpp"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
+#include "BaseGraph/parallel.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+static const char LANDMARK_ORACLE_FILE_TAG[] = "BaseGraphLandmarks1";
+const uint32_t LandmarkDistanceOracle::UNREACHABLE;
+
+// Stores d(landmarks[i], v) in distances[v*k+i]. The landmarks are split in one
+// contiguous chunk per thread, each with its own search workspace.
+template <typename T>
+static void searchFromLandmarks(const T& graph, const vector<VertexIndex>& landmarks, vector<uint32_t>& distances, size_t threadNumber) {
+    size_t landmarkNumber = landmarks.size();
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    size_t chunkNumber = threadNumber < landmarkNumber ? threadNumber : landmarkNumber;
+
+    parallelFor(0, chunkNumber, [&](size_t chunk) {
+        BreadthFirstSearch<T> workspace(graph);
+        for (size_t i=chunk*landmarkNumber/chunkNumber; i<(chunk+1)*landmarkNumber/chunkNumber; i++) {
+            workspace.run(landmarks[i]);
+            for (VertexIndex vertex: workspace.getVisitedVertices())
+                distances[vertex*landmarkNumber+i] = workspace.getDistances()[vertex];
+        }
+    }, chunkNumber);
+}
+
+static vector<size_t> getTotalDegrees(const DirectedGraph& graph) {
+    vector<size_t> degrees = graph.getOutDegrees();
+    for (VertexIndex vertex: graph)
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            degrees[neighbour]++;
+    return degrees;
+}
+
+static vector<size_t> getTotalDegrees(const UndirectedGraph& graph) {
+    return graph.getDegrees();
+}
+
+LandmarkDistanceOracle::LandmarkDistanceOracle(const DirectedGraph& graph, size_t landmarkNumber,
+        LandmarkSelection selection, size_t threadNumber) {
+    build(graph, landmarkNumber, selection, threadNumber);
+    directed = true;
+    toLandmarks.assign(fromLandmarks.size(), UNREACHABLE);
+    searchFromLandmarks(graph.getReversedGraph(), landmarks, toLandmarks, threadNumber);
+}
+
+LandmarkDistanceOracle::LandmarkDistanceOracle(const UndirectedGraph& graph, size_t landmarkNumber,
+        LandmarkSelection selection, size_t threadNumber) {
+    build(graph, landmarkNumber, selection, threadNumber);
+    directed = false;
+}
+
+template <typename T>
+void LandmarkDistanceOracle::build(const T& graph, size_t landmarkNumber, LandmarkSelection selection, size_t threadNumber) {
+    verticesNumber = graph.getSize();
+    if (landmarkNumber == 0 && verticesNumber > 0)
+        throw invalid_argument("At least one landmark is required.");
+    if (landmarkNumber > verticesNumber)
+        landmarkNumber = verticesNumber;
+
+    vector<size_t> degrees = getTotalDegrees(graph);
+    vector<VertexIndex> vertices(verticesNumber);
+    for (VertexIndex vertex: graph)
+        vertices[vertex] = vertex;
+    // Ties are broken by vertex index so that the landmarks do not depend on the sort
+    auto hasHigherDegree = [&](VertexIndex vertex1, VertexIndex vertex2) {
+        return degrees[vertex1] > degrees[vertex2] || (degrees[vertex1] == degrees[vertex2] && vertex1 < vertex2);
+    };
+
+    fromLandmarks.assign(verticesNumber*landmarkNumber, UNREACHABLE);
+    landmarks.clear();
+
+    if (selection == HIGHEST_DEGREE) {
+        partial_sort(vertices.begin(), vertices.begin()+landmarkNumber, vertices.end(), hasHigherDegree);
+        landmarks.assign(vertices.begin(), vertices.begin()+landmarkNumber);
+        searchFromLandmarks(graph, landmarks, fromLandmarks, threadNumber);
+    }
+    else if (selection == FARTHEST_POINT) {
+        if (verticesNumber == 0)
+            return;
+        // Unreached vertices are the farthest, so every component gets a landmark
+        vector<size_t> distancesToLandmarks(verticesNumber, SIZE_T_MAX);
+        BreadthFirstSearch<T> workspace(graph);
+
+        VertexIndex landmark = *min_element(vertices.begin(), vertices.end(), hasHigherDegree);
+        for (size_t i=0; i<landmarkNumber; i++) {
+            landmarks.push_back(landmark);
+            workspace.run(landmark);
+            for (VertexIndex vertex: workspace.getVisitedVertices()) {
+                size_t distance = workspace.getDistances()[vertex];
+                fromLandmarks[vertex*landmarkNumber+i] = distance;
+                if (distance < distancesToLandmarks[vertex])
+                    distancesToLandmarks[vertex] = distance;
+            }
+            landmark = max_element(distancesToLandmarks.begin(), distancesToLandmarks.end()) - distancesToLandmarks.begin();
+        }
+    }
+    else
+        throw invalid_argument("Unknown landmark selection.");
+}
+
+void LandmarkDistanceOracle::assertVertexInRange(VertexIndex vertex) const {
+    if (vertex >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(vertex) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+}
+
+pair<size_t, size_t> LandmarkDistanceOracle::getDistanceBoundsIdx(VertexIndex vertex1, VertexIndex vertex2) const {
+    assertVertexInRange(vertex1);
+    assertVertexInRange(vertex2);
+    if (vertex1 == vertex2)
+        return {0, 0};
+
+    size_t landmarkNumber = landmarks.size();
+    const uint32_t* fromLandmarks1 = &fromLandmarks[vertex1*landmarkNumber];
+    const uint32_t* fromLandmarks2 = &fromLandmarks[vertex2*landmarkNumber];
+    const uint32_t* toLandmarks1 = directed ? &toLandmarks[vertex1*landmarkNumber] : fromLandmarks1;
+    const uint32_t* toLandmarks2 = directed ? &toLandmarks[vertex2*landmarkNumber] : fromLandmarks2;
+
+    size_t lowerBound = 1, upperBound = SIZE_T_MAX;
+    for (size_t i=0; i<landmarkNumber; i++) {
+        // d(L,v2) <= d(L,v1) + d(v1,v2) and d(v1,L) <= d(v1,v2) + d(v2,L)
+        if (fromLandmarks1[i] != UNREACHABLE) {
+            if (fromLandmarks2[i] == UNREACHABLE)
+                return {SIZE_T_MAX, SIZE_T_MAX};
+            if (fromLandmarks2[i] > fromLandmarks1[i])
+                lowerBound = max(lowerBound, (size_t) fromLandmarks2[i]-fromLandmarks1[i]);
+        }
+        if (toLandmarks2[i] != UNREACHABLE) {
+            if (toLandmarks1[i] == UNREACHABLE)
+                return {SIZE_T_MAX, SIZE_T_MAX};
+            if (toLandmarks1[i] > toLandmarks2[i])
+                lowerBound = max(lowerBound, (size_t) toLandmarks1[i]-toLandmarks2[i]);
+        }
+        if (toLandmarks1[i] != UNREACHABLE && fromLandmarks2[i] != UNREACHABLE)
+            upperBound = min(upperBound, (size_t) toLandmarks1[i]+fromLandmarks2[i]);
+    }
+    return {lowerBound, upperBound};
+}
+
+void LandmarkDistanceOracle::writeInBinaryStream(ostream& stream) const {
+    uint64_t fileVerticesNumber = verticesNumber, landmarkNumber = landmarks.size();
+    uint8_t fileDirected = directed;
+
+    stream.write(LANDMARK_ORACLE_FILE_TAG, sizeof(LANDMARK_ORACLE_FILE_TAG));
+    stream.write((char*) &fileVerticesNumber, sizeof(fileVerticesNumber));
+    stream.write((char*) &fileDirected, sizeof(fileDirected));
+    stream.write((char*) &landmarkNumber, sizeof(landmarkNumber));
+    for (VertexIndex landmark: landmarks) {
+        uint64_t fixedSizeLandmark = landmark;
+        stream.write((char*) &fixedSizeLandmark, sizeof(fixedSizeLandmark));
+    }
+    stream.write((char*) fromLandmarks.data(), fromLandmarks.size()*sizeof(uint32_t));
+    stream.write((char*) toLandmarks.data(), toLandmarks.size()*sizeof(uint32_t));
+}
+
+void LandmarkDistanceOracle::loadFromBinaryStream(istream& stream) {
+    char tag[sizeof(LANDMARK_ORACLE_FILE_TAG)];
+    uint64_t fileVerticesNumber, landmarkNumber;
+    uint8_t fileDirected;
+
+    stream.read(tag, sizeof(tag));
+    if (!stream || string(tag) != LANDMARK_ORACLE_FILE_TAG)
+        throw runtime_error("Stream does not contain a landmark distance oracle.");
+    stream.read((char*) &fileVerticesNumber, sizeof(fileVerticesNumber));
+    stream.read((char*) &fileDirected, sizeof(fileDirected));
+    stream.read((char*) &landmarkNumber, sizeof(landmarkNumber));
+    if (!stream || landmarkNumber > fileVerticesNumber || fileDirected > 1)
+        throw runtime_error("Corrupted landmark distance oracle.");
+
+    // The sizes are validated against the stream before any allocation
+    uint64_t remainingSize = getRemainingStreamSize(stream);
+    if (!fitsInRemainingSize(landmarkNumber, sizeof(uint64_t), remainingSize))
+        throw runtime_error("Corrupted landmark distance oracle: the stream is too short.");
+    remainingSize -= landmarkNumber*sizeof(uint64_t);
+    if (landmarkNumber > 0 && fileVerticesNumber > numeric_limits<uint64_t>::max()/landmarkNumber)
+        throw runtime_error("Corrupted landmark distance oracle.");
+    uint64_t distanceNumber = fileVerticesNumber*landmarkNumber;
+    if (!fitsInRemainingSize(distanceNumber, (fileDirected ? 2 : 1)*sizeof(uint32_t), remainingSize))
+        throw runtime_error("Corrupted landmark distance oracle: the stream is too short.");
+
+    LandmarkDistanceOracle loaded;
+    loaded.verticesNumber = fileVerticesNumber;
+    loaded.directed = fileDirected;
+    loaded.landmarks.resize(landmarkNumber);
+    for (VertexIndex& landmark: loaded.landmarks) {
+        uint64_t fixedSizeLandmark;
+        stream.read((char*) &fixedSizeLandmark, sizeof(fixedSizeLandmark));
+        if (fixedSizeLandmark >= fileVerticesNumber)
+            throw runtime_error("Corrupted landmark distance oracle.");
+        landmark = fixedSizeLandmark;
+    }
+    loaded.fromLandmarks.resize(distanceNumber);
+    loaded.toLandmarks.resize(fileDirected ? distanceNumber : 0);
+    stream.read((char*) loaded.fromLandmarks.data(), loaded.fromLandmarks.size()*sizeof(uint32_t));
+    stream.read((char*) loaded.toLandmarks.data(), loaded.toLandmarks.size()*sizeof(uint32_t));
+    if (!stream)
+        throw runtime_error("Corrupted landmark distance oracle.");
+
+    *this = move(loaded);
+}
+
+void LandmarkDistanceOracle::writeInBinaryFile(const string& fileName) const {
+    ofstream fileStream(fileName, ios::binary);
+    if (!fileStream.is_open())
+        throw runtime_error("Could not open file.");
+    writeInBinaryStream(fileStream);
+}
+
+void LandmarkDistanceOracle::loadFromBinaryFile(const string& fileName) {
+    ifstream fileStream(fileName, ios::binary);
+    if (!fileStream.is_open())
+        throw runtime_error("Could not open file.");
+    loadFromBinaryStream(fileStream);
+}
+
+} // namespace BaseGraph
@@ -2,9 +2,13 @@
 #include <queue>
 #include <stack>
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
 
 #include <BaseGraph/undirectedgraph.h>
 #include "BaseGraph/algorithms/graphpaths.h"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
 
 
 using namespace std;
@@ -12,17 +16,103 @@ using namespace std;
 
 namespace BaseGraph{
 
-template <typename T>
-Path findGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx) {
+// Breadth-first searches from the source along forward edges and from the destination
+// along backward edges, always expanding the smallest frontier by a whole level and
+// stopping at the first level where the searches meet. forEachForwardNeighbour(v, f)
+// and forEachBackwardNeighbour(v, f) call f on the neighbours of v.
+template <typename ForwardNeighbours, typename BackwardNeighbours>
+static Path findBidirectionalGeodesic(size_t verticesNumber, VertexIndex sourceIdx, VertexIndex destinationIdx,
+        ForwardNeighbours forEachForwardNeighbour, BackwardNeighbours forEachBackwardNeighbour) {
+    if (sourceIdx >= verticesNumber || destinationIdx >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(max(sourceIdx, destinationIdx)) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
     if (sourceIdx == destinationIdx)
         return {sourceIdx};
 
-    auto predecessors = findPredecessorsOfVertexIdx(graph, sourceIdx);
+    struct SearchSide {
+        // Distances are SIZE_T_MAX for the vertices not reached by this side
+        vector<size_t> distances;
+        vector<VertexIndex> parents;
+        vector<VertexIndex> frontier, nextFrontier;
+        size_t depth = 0;
+
+        SearchSide(size_t verticesNumber, VertexIndex root):
+                distances(verticesNumber, SIZE_T_MAX), parents(verticesNumber, SIZE_T_MAX), frontier(1, root) {
+            distances[root] = 0;
+        }
+    } forward(verticesNumber, sourceIdx), backward(verticesNumber, destinationIdx);
+
+    VertexIndex meetingVertex = SIZE_T_MAX;
+    size_t pathLength = SIZE_T_MAX;
+
+    while (meetingVertex == SIZE_T_MAX && !forward.frontier.empty() && !backward.frontier.empty()) {
+        bool expandForward = forward.frontier.size() <= backward.frontier.size();
+        SearchSide& side = expandForward ? forward : backward;
+        const SearchSide& otherSide = expandForward ? backward : forward;
+
+        side.nextFrontier.clear();
+        auto visit = [&](VertexIndex vertex, VertexIndex neighbour) {
+            if (side.distances[neighbour] != SIZE_T_MAX)
+                return;
+            side.distances[neighbour] = side.depth+1;
+            side.parents[neighbour] = vertex;
+            side.nextFrontier.push_back(neighbour);
+
+            // Every meeting of the level is checked to find the shortest path
+            size_t otherDistance = otherSide.distances[neighbour];
+            if (otherDistance != SIZE_T_MAX && side.depth+1+otherDistance < pathLength) {
+                pathLength = side.depth+1+otherDistance;
+                meetingVertex = neighbour;
+            }
+        };
+        for (VertexIndex vertex: side.frontier) {
+            if (expandForward)
+                forEachForwardNeighbour(vertex, [&](VertexIndex neighbour) { visit(vertex, neighbour); });
+            else
+                forEachBackwardNeighbour(vertex, [&](VertexIndex neighbour) { visit(vertex, neighbour); });
+        }
+        side.frontier.swap(side.nextFrontier);
+        side.depth++;
+    }
+
+    Path path;
+    if (meetingVertex == SIZE_T_MAX)
+        return path;
+    for (VertexIndex vertex=meetingVertex; vertex!=SIZE_T_MAX; vertex=forward.parents[vertex])
+        path.push_front(vertex);
+    for (VertexIndex vertex=backward.parents[meetingVertex]; vertex!=SIZE_T_MAX; vertex=backward.parents[vertex])
+        path.push_back(vertex);
+    return path;
+}
+
+// Neighbour iterations given to findBidirectionalGeodesic
+struct OutNeighbours {
+    const DirectedGraph& graph;
+    template <typename Function> void operator()(VertexIndex vertex, Function function) const {
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            function(neighbour);
+    }
+};
+struct ListedNeighbours {
+    const AdjacencyLists& lists;
+    template <typename Function> void operator()(VertexIndex vertex, Function function) const {
+        for (const VertexIndex& neighbour: lists[vertex])
+            function(neighbour);
+    }
+};
+
+// A single query allocates the buffers of a workspace (and builds the in edges of a
+// DirectedGraph), which costs O(V+E) like a single search
+template <typename T>
+Path findGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx) {
+    BreadthFirstSearch<T> workspace(graph);
+    return findGeodesicsIdx(graph, sourceIdx, destinationIdx, workspace);
+}
 
-    if (predecessors.first[destinationIdx] != SIZE_T_MAX)
-        return findPathToVertexFromPredecessorsIdx(graph, sourceIdx, destinationIdx, predecessors);
-    else
-        return {};
+Path findGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, const AdjacencyLists& inEdges) {
+    if (inEdges.size() != graph.getSize())
+        throw invalid_argument("The in edges must contain one list per vertex.");
+    return findBidirectionalGeodesic(graph.getSize(), sourceIdx, destinationIdx, OutNeighbours{graph}, ListedNeighbours{inEdges});
 }
 
 template <typename T>
@@ -30,113 +120,158 @@ MultiplePaths findAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexI
     if (sourceIdx == destinationIdx)
         return {{sourceIdx}};
 
-    auto predecessors = findAllPredecessorsOfVertexIdx(graph, sourceIdx);
-
-    if (predecessors.first[destinationIdx] != SIZE_T_MAX)
-        return findMultiplePathsToVertexFromPredecessorsIdx(graph, sourceIdx, destinationIdx, predecessors);
-    else
-        return {};
+    return findMultiplePathsToVertexFromPredecessorDAGIdx(findPredecessorDAGOfVertexIdx(graph, sourceIdx), destinationIdx);
 }
 
 template <typename T>
 vector<Path> findGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx) {
-    auto predecessors = findPredecessorsOfVertexIdx(graph, vertexIdx);
-
-    vector<Path> geodesics;
-
-    for (VertexIndex j: graph) {
-        if (predecessors.first[j] != SIZE_T_MAX && j != vertexIdx)
-            geodesics.push_back(findPathToVertexFromPredecessorsIdx(graph, vertexIdx, j, predecessors));
-        else
-            geodesics.push_back({});
-    }
-    return geodesics;
+    BreadthFirstSearch<T> workspace(graph);
+    return findGeodesicsFromVertexIdx(graph, vertexIdx, workspace);
 }
 
 template <typename T>
 vector<MultiplePaths> findAllGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx) {
-    auto predecessors = findAllPredecessorsOfVertexIdx(graph, vertexIdx);
+    auto predecessorDAG = findPredecessorDAGOfVertexIdx(graph, vertexIdx);
 
     vector<MultiplePaths> allGeodesics;
 
     for (VertexIndex j: graph)
-        if (predecessors.first[j] != SIZE_T_MAX && j != vertexIdx)
-            allGeodesics.push_back(findMultiplePathsToVertexFromPredecessorsIdx(graph, vertexIdx, j, predecessors));
+        if (j != vertexIdx)
+            allGeodesics.push_back(findMultiplePathsToVertexFromPredecessorDAGIdx(predecessorDAG, j));
         else
             allGeodesics.push_back({});
     return allGeodesics;
 }
 
+template <typename T>
+static void runWorkspace(const T& graph, VertexIndex sourceIdx, BreadthFirstSearch<T>& workspace) {
+    if (&workspace.getGraph() != &graph)
+        throw invalid_argument("The workspace was created for another graph.");
+    workspace.run(sourceIdx);
+}
+
+template <typename T>
+static Path findPathInWorkspace(VertexIndex sourceIdx, VertexIndex destinationIdx, const BreadthFirstSearch<T>& workspace) {
+    auto& predecessors = workspace.getPredecessors();
+    Path path;
+    for (VertexIndex vertex=destinationIdx; vertex!=sourceIdx; vertex=predecessors[vertex])
+        path.push_front(vertex);
+    path.push_front(sourceIdx);
+    return path;
+}
+
+template <typename T>
+Path findGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, BreadthFirstSearch<T>& workspace) {
+    if (sourceIdx == destinationIdx)
+        return {sourceIdx};
+    if (&workspace.getGraph() != &graph)
+        throw invalid_argument("The workspace was created for another graph.");
+
+    workspace.runBidirectional(sourceIdx, destinationIdx);
+    VertexIndex meetingVertex = workspace.getMeetingVertex();
+    Path path;
+    if (meetingVertex == SIZE_T_MAX)
+        return path;
+    for (VertexIndex vertex=meetingVertex; vertex!=SIZE_T_MAX; vertex=workspace.getPredecessors()[vertex])
+        path.push_front(vertex);
+    for (VertexIndex vertex=workspace.getSuccessors()[meetingVertex]; vertex!=SIZE_T_MAX; vertex=workspace.getSuccessors()[vertex])
+        path.push_back(vertex);
+    return path;
+}
+
+template <typename T>
+vector<Path> findGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx, BreadthFirstSearch<T>& workspace) {
+    runWorkspace(graph, vertexIdx, workspace);
+
+    vector<Path> geodesics(graph.getSize());
+    for (VertexIndex j: workspace.getVisitedVertices())
+        if (j != vertexIdx)
+            geodesics[j] = findPathInWorkspace(vertexIdx, j, workspace);
+    return geodesics;
+}
+
 template <typename T>
 Predecessors findPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx){
-    VertexIndex currentVertex = vertexIdx;
+    BreadthFirstSearch<T> workspace(graph);
+    return findPredecessorsOfVertexIdx(graph, vertexIdx, workspace);
+}
+
+template <typename T>
+Predecessors findPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx, BreadthFirstSearch<T>& workspace){
+    runWorkspace(graph, vertexIdx, workspace);
+    return {workspace.getDistances(), workspace.getPredecessors()};
+}
+
+// The predecessors are counted during the breadth-first search and stored once the
+// counts are known. Parallel edges give a single predecessor.
+template <typename T>
+PredecessorDAG findPredecessorDAGOfVertexIdx(const T& graph, VertexIndex vertexIdx) {
     size_t verticesNumber = graph.getSize();
-    vector<size_t> shortestPaths;
-    vector<VertexIndex> predecessor;
-    vector<bool> processedVertices;
-    queue<VertexIndex> verticesToProcess;
-
-    shortestPaths.resize(verticesNumber, SIZE_T_MAX);
-    shortestPaths[currentVertex] = 0;
-    predecessor.resize(verticesNumber, SIZE_T_MAX);
-    processedVertices.resize(verticesNumber, false);
-    processedVertices[currentVertex] = true;
-    verticesToProcess.push(currentVertex);
-
-    while(!verticesToProcess.empty()){
-        currentVertex = verticesToProcess.front();
-
-        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(currentVertex)) {
-            if (!processedVertices[neighbour]){
-                verticesToProcess.push(neighbour);
-                processedVertices[neighbour] = true;
-                predecessor[neighbour] = currentVertex;
-                shortestPaths[neighbour] = shortestPaths[currentVertex] + 1;
+    if (vertexIdx >= verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(vertexIdx) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+
+    PredecessorDAG predecessorDAG;
+    predecessorDAG.source = vertexIdx;
+    vector<size_t>& distances = predecessorDAG.distances;
+    vector<size_t>& offsets = predecessorDAG.offsets;
+    distances.assign(verticesNumber, SIZE_T_MAX);
+    offsets.assign(verticesNumber+1, 0);
+
+    vector<VertexIndex> lastParents(verticesNumber, SIZE_T_MAX);
+    vector<VertexIndex> visitedVertices(1, vertexIdx);
+    distances[vertexIdx] = 0;
+
+    for (size_t i=0; i<visitedVertices.size(); i++) {
+        VertexIndex vertex = visitedVertices[i];
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == SIZE_T_MAX) {
+                distances[neighbour] = distances[vertex]+1;
+                visitedVertices.push_back(neighbour);
+            }
+            if (distances[neighbour] == distances[vertex]+1 && lastParents[neighbour] != vertex) {
+                lastParents[neighbour] = vertex;
+                offsets[neighbour+1]++;
+            }
+        }
+    }
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+        offsets[vertex+1] += offsets[vertex];
+
+    predecessorDAG.predecessors.resize(offsets[verticesNumber]);
+    vector<size_t> insertPositions(offsets.begin(), offsets.end()-1);
+    for (VertexIndex vertex: visitedVertices)
+        lastParents[vertex] = SIZE_T_MAX;
+    for (VertexIndex vertex: visitedVertices) {
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == distances[vertex]+1 && lastParents[neighbour] != vertex) {
+                lastParents[neighbour] = vertex;
+                predecessorDAG.predecessors[insertPositions[neighbour]++] = vertex;
             }
         }
-        verticesToProcess.pop();
     }
-    return {shortestPaths, predecessor};
+    return predecessorDAG;
+}
+
+MultiplePaths findMultiplePathsToVertexFromPredecessorDAGIdx(const PredecessorDAG& predecessorDAG, VertexIndex destinationIdx) {
+    MultiplePaths paths;
+    if (destinationIdx == predecessorDAG.source)
+        return paths;
+
+    GeodesicGenerator generator(predecessorDAG, destinationIdx);
+    while (generator.next())
+        paths.emplace_back(generator.getGeodesic().begin(), generator.getGeodesic().end());
+    return paths;
 }
 
 template <typename T>
 MultiplePredecessors findAllPredecessorsOfVertexIdx(const T& graph, VertexIndex vertexIdx){
-    VertexIndex currentVertex = vertexIdx;
-    size_t verticesNumber = graph.getSize();
-    vector<size_t> shortestPaths;
-    vector<list<VertexIndex>> predecessor;
-    vector<bool> processedVertices;
-    queue<VertexIndex> verticesToProcess;
-
-    shortestPaths.resize(verticesNumber, SIZE_T_MAX);
-    shortestPaths[currentVertex] = 0;
-    predecessor.resize(verticesNumber, list<VertexIndex>());
-    processedVertices.resize(verticesNumber, false);
-    processedVertices[currentVertex] = true;
-    verticesToProcess.push(currentVertex);
-
-    size_t newPathLength;
-    while(!verticesToProcess.empty()){
-        currentVertex = verticesToProcess.front();
-
-        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(currentVertex)){
-            if (!processedVertices[neighbour]){
-                verticesToProcess.push(neighbour);
-                newPathLength = shortestPaths[currentVertex] + 1;
-
-                // if paths are same length and vertex not added
-                // newPathLength < shortestPaths[neighbour] because shortestPaths is initialized to SIZE_T_MAX
-                if (newPathLength <= shortestPaths[neighbour] &&
-                        find(predecessor[neighbour].begin(), predecessor[neighbour].end(), currentVertex) == predecessor[neighbour].end()){
-                    shortestPaths[neighbour] = newPathLength;
-                    predecessor[neighbour].push_back(currentVertex);
-                }
-            }
-        }
-        processedVertices[currentVertex] = true;
-        verticesToProcess.pop();
-    }
-    return {shortestPaths, predecessor};
+    PredecessorDAG predecessorDAG = findPredecessorDAGOfVertexIdx(graph, vertexIdx);
+
+    vector<list<VertexIndex>> predecessors(graph.getSize());
+    for (VertexIndex vertex: graph)
+        predecessors[vertex].assign(predecessorDAG.beginPredecessors(vertex), predecessorDAG.endPredecessors(vertex));
+    return {move(predecessorDAG.distances), move(predecessors)};
 }
 
 VertexIndex findSourceVertex(vector<size_t> geodesicLengths){
@@ -224,6 +359,114 @@ MultiplePaths findMultiplePathsToVertexFromPredecessorsIdx(const T& graph, Verte
     return paths;
 }
 
+GeodesicGenerator::GeodesicGenerator(shared_ptr<const PredecessorDAG> predecessorDAG, VertexIndex destinationIdx):
+        ownedPredecessorDAG(predecessorDAG), predecessorDAG(predecessorDAG.get()) {
+    if (predecessorDAG == nullptr)
+        throw invalid_argument("The predecessor DAG must not be null.");
+    start(destinationIdx);
+}
+
+GeodesicGenerator::GeodesicGenerator(const PredecessorDAG& predecessorDAG, VertexIndex destinationIdx):
+        predecessorDAG(&predecessorDAG) {
+    start(destinationIdx);
+}
+
+void GeodesicGenerator::start(VertexIndex destinationIdx) {
+    const vector<size_t>& distances = predecessorDAG->distances;
+    if (destinationIdx >= distances.size())
+        throw out_of_range("Vertex index (" + to_string(destinationIdx) +
+                ") greater than the graph's size("+ to_string(distances.size()) +").");
+
+    if (distances[destinationIdx] == SIZE_T_MAX) {
+        finished = true;
+        return;
+    }
+    geodesic.resize(distances[destinationIdx]+1);
+    positions.resize(distances[destinationIdx]);
+    geodesic.back() = destinationIdx;
+    takeLastPredecessors(positions.size());
+}
+
+void GeodesicGenerator::takeLastPredecessors(size_t levelsNumber) {
+    for (size_t level=levelsNumber; level-- > 0;) {
+        positions[level] = predecessorDAG->offsets[geodesic[level+1]+1]-1;
+        geodesic[level] = predecessorDAG->predecessors[positions[level]];
+    }
+}
+
+bool GeodesicGenerator::next() {
+    if (finished)
+        return false;
+    if (!started) {
+        started = true;
+        return true;
+    }
+
+    // Predecessors are taken from last to first and the vertices closest to the
+    // source change first, which is the order of the depth-first enumeration.
+    for (size_t level=0; level<positions.size(); level++) {
+        if (positions[level] > predecessorDAG->offsets[geodesic[level+1]]) {
+            geodesic[level] = predecessorDAG->predecessors[--positions[level]];
+            takeLastPredecessors(level);
+            return true;
+        }
+    }
+    finished = true;
+    return false;
+}
+
+template <typename T>
+GeodesicGenerator generateAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx) {
+    return GeodesicGenerator(make_shared<PredecessorDAG>(findPredecessorDAGOfVertexIdx(graph, sourceIdx)), destinationIdx);
+}
+
+// Counts the geodesics from the source during a breadth-first search. Parallel edges
+// are counted once, like in findAllPredecessorsOfVertexIdx. The search stops after
+// the level of the destination.
+template <typename T>
+static vector<size_t> countGeodesics(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx=SIZE_T_MAX) {
+    size_t verticesNumber = graph.getSize();
+    if (sourceIdx >= verticesNumber || (destinationIdx != SIZE_T_MAX && destinationIdx >= verticesNumber))
+        throw out_of_range("Vertex index (" + to_string(sourceIdx >= verticesNumber ? sourceIdx : destinationIdx) +
+                ") greater than the graph's size("+ to_string(verticesNumber) +").");
+
+    vector<size_t> distances(verticesNumber, SIZE_T_MAX), geodesicNumbers(verticesNumber, 0);
+    vector<VertexIndex> lastParents(verticesNumber, SIZE_T_MAX);
+    vector<VertexIndex> visitedVertices(1, sourceIdx);
+    distances[sourceIdx] = 0;
+    geodesicNumbers[sourceIdx] = 1;
+
+    for (size_t i=0; i<visitedVertices.size(); i++) {
+        VertexIndex vertex = visitedVertices[i];
+        if (destinationIdx != SIZE_T_MAX && distances[vertex] == distances[destinationIdx])
+            break;
+
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == SIZE_T_MAX) {
+                distances[neighbour] = distances[vertex]+1;
+                visitedVertices.push_back(neighbour);
+            }
+            if (distances[neighbour] == distances[vertex]+1 && lastParents[neighbour] != vertex) {
+                lastParents[neighbour] = vertex;
+                if (geodesicNumbers[neighbour] > SIZE_T_MAX-geodesicNumbers[vertex])
+                    throw overflow_error("The number of geodesics does not fit in a size_t.");
+                geodesicNumbers[neighbour] += geodesicNumbers[vertex];
+            }
+        }
+    }
+    return geodesicNumbers;
+}
+
+template <typename T>
+size_t countAllGeodesicsIdx(const T& graph, VertexIndex sourceIdx, VertexIndex destinationIdx) {
+    return countGeodesics(graph, sourceIdx, destinationIdx)[destinationIdx];
+}
+
+template <typename T>
+vector<size_t> countAllGeodesicsFromVertexIdx(const T& graph, VertexIndex vertexIdx) {
+    return countGeodesics(graph, vertexIdx);
+}
+
 // Allowed classes
 
 template Path findGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
@@ -234,10 +477,22 @@ template std::vector<Path> findGeodesicsFromVertexIdx(const DirectedGraph& graph
 template std::vector<Path> findGeodesicsFromVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
 template std::vector<MultiplePaths> findAllGeodesicsFromVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx);
 template std::vector<MultiplePaths> findAllGeodesicsFromVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
+template GeodesicGenerator generateAllGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+template GeodesicGenerator generateAllGeodesicsIdx(const UndirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+template size_t countAllGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+template size_t countAllGeodesicsIdx(const UndirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx);
+template std::vector<size_t> countAllGeodesicsFromVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx);
+template std::vector<size_t> countAllGeodesicsFromVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
+template Path findGeodesicsIdx(const DirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, BreadthFirstSearch<DirectedGraph>& workspace);
+template Path findGeodesicsIdx(const UndirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, BreadthFirstSearch<UndirectedGraph>& workspace);
+template std::vector<Path> findGeodesicsFromVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx, BreadthFirstSearch<DirectedGraph>& workspace);
+template std::vector<Path> findGeodesicsFromVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx, BreadthFirstSearch<UndirectedGraph>& workspace);
 
 
 template Predecessors findPredecessorsOfVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx);
 template Predecessors findPredecessorsOfVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
+template Predecessors findPredecessorsOfVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx, BreadthFirstSearch<DirectedGraph>& workspace);
+template Predecessors findPredecessorsOfVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx, BreadthFirstSearch<UndirectedGraph>& workspace);
 template Path findPathToVertexFromPredecessorsIdx(
         const DirectedGraph& graph, VertexIndex destinationIdx, const Predecessors& predecessors);
 template Path findPathToVertexFromPredecessorsIdx(
@@ -248,6 +503,8 @@ template Path findPathToVertexFromPredecessorsIdx(
         const UndirectedGraph& graph, VertexIndex sourceIdx, VertexIndex destinationIdx, const Predecessors& predecessors);
 
 
+template PredecessorDAG findPredecessorDAGOfVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx);
+template PredecessorDAG findPredecessorDAGOfVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
 template MultiplePredecessors findAllPredecessorsOfVertexIdx(const DirectedGraph& graph, VertexIndex vertexIdx);
 template MultiplePredecessors findAllPredecessorsOfVertexIdx(const UndirectedGraph& graph, VertexIndex vertexIdx);
 template MultiplePaths findMultiplePathsToVertexFromPredecessorsIdx(
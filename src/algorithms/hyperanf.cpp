@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "BaseGraph/algorithms/hyperanf.h"
+#include "BaseGraph/algorithms/randomgraphs.h"
+#include "BaseGraph/parallel.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+// Finalizer of SplitMix64, which spreads consecutive indices over every bit
+static uint64_t hashVertex(VertexIndex vertex, uint64_t seed) {
+    uint64_t hash = (uint64_t) vertex + seed + 0x9e3779b97f4a7c15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return hash ^ (hash >> 31);
+}
+
+static uint8_t countLeadingZeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return value == 0 ? 64 : __builtin_clzll(value);
+#else
+    uint8_t zeros = 0;
+    for (uint64_t bit=uint64_t(1)<<63; bit != 0 && !(value & bit); bit >>= 1)
+        zeros++;
+    return zeros;
+#endif
+}
+
+class HyperLogLogCounters {
+    public:
+        HyperLogLogCounters(size_t counterNumber, size_t log2RegisterNumber):
+            log2RegisterNumber(log2RegisterNumber), registerNumber(size_t(1) << log2RegisterNumber),
+            registers(counterNumber << log2RegisterNumber, 0)
+        {
+            double m = registerNumber;
+            if (registerNumber == 16)      alpha = 0.673;
+            else if (registerNumber == 32) alpha = 0.697;
+            else if (registerNumber == 64) alpha = 0.709;
+            else                           alpha = 0.7213/(1+1.079/m);
+            for (size_t value=0; value<65; value++)
+                inversePowers[value] = ldexp(1., -(int) value);
+        }
+
+        uint8_t* getCounter(size_t counter) { return &registers[counter << log2RegisterNumber]; }
+        const uint8_t* getCounter(size_t counter) const { return &registers[counter << log2RegisterNumber]; }
+
+        void add(size_t counter, uint64_t hash) {
+            size_t index = hash >> (64-log2RegisterNumber);
+            uint8_t value = countLeadingZeros(hash << log2RegisterNumber) + 1;
+            value = min<uint8_t>(value, 64-log2RegisterNumber+1);
+            uint8_t& currentValue = getCounter(counter)[index];
+            currentValue = max(currentValue, value);
+        }
+
+        // Registerwise maximum. Returns whether the destination changed.
+        bool merge(uint8_t* destination, const uint8_t* source) const {
+            uint8_t changed = 0;
+            for (size_t i=0; i<registerNumber; i++) {
+                uint8_t value = max(destination[i], source[i]);
+                changed |= value ^ destination[i];
+                destination[i] = value;
+            }
+            return changed != 0;
+        }
+
+        // HyperLogLog estimate with linear counting for small cardinalities
+        double estimate(const uint8_t* counter) const {
+            double sum = 0;
+            size_t zeros = 0;
+            for (size_t i=0; i<registerNumber; i++) {
+                sum += inversePowers[counter[i]];
+                zeros += counter[i] == 0;
+            }
+            double m = registerNumber;
+            double estimate = alpha*m*m/sum;
+            if (estimate <= 2.5*m && zeros > 0)
+                estimate = m*log(m/zeros);
+            return estimate;
+        }
+
+        size_t getRegisterNumber() const { return registerNumber; }
+        void swap(HyperLogLogCounters& other) { registers.swap(other.registers); }
+
+    private:
+        size_t log2RegisterNumber, registerNumber;
+        double alpha;
+        double inversePowers[65];
+        vector<uint8_t> registers;
+};
+
+
+template <typename T>
+NeighbourhoodFunction estimateNeighbourhoodFunction(const T& graph, size_t log2RegisterNumber, size_t threadNumber) {
+    if (log2RegisterNumber < 4 || log2RegisterNumber > 16)
+        throw invalid_argument("The number of registers must be between 2^4 and 2^16.");
+
+    size_t verticesNumber = graph.getSize();
+    NeighbourhoodFunction neighbourhoodFunction;
+    neighbourhoodFunction.harmonicCentralities.assign(verticesNumber, 0);
+    if (verticesNumber == 0)
+        return neighbourhoodFunction;
+
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    size_t chunkNumber = min(threadNumber, verticesNumber);
+
+    HyperLogLogCounters counters(verticesNumber, log2RegisterNumber), nextCounters(verticesNumber, log2RegisterNumber);
+    size_t registerNumber = counters.getRegisterNumber();
+    uint64_t seed = rng();
+
+    vector<double> estimates(verticesNumber);
+    double pairNumber = 0;
+    for (VertexIndex vertex: graph) {
+        counters.add(vertex, hashVertex(vertex, seed));
+        estimates[vertex] = counters.estimate(counters.getCounter(vertex));
+        pairNumber += estimates[vertex];
+    }
+    neighbourhoodFunction.pairNumbers.push_back(pairNumber);
+
+    // char instead of bool so that threads write distinct bytes
+    vector<char> changed(verticesNumber, 1), nextChanged(verticesNumber);
+    vector<double> chunkPairNumbers(chunkNumber);
+    vector<size_t> chunkChangedNumbers(chunkNumber);
+
+    for (size_t distance=1; ; distance++) {
+        parallelFor(0, chunkNumber, [&](size_t chunk) {
+            double chunkPairNumber = 0;
+            size_t chunkChangedNumber = 0;
+            for (VertexIndex vertex=chunk*verticesNumber/chunkNumber; vertex<(chunk+1)*verticesNumber/chunkNumber; vertex++) {
+                uint8_t* counter = nextCounters.getCounter(vertex);
+                memcpy(counter, counters.getCounter(vertex), registerNumber);
+
+                bool vertexChanged = false;
+                for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+                    if (changed[neighbour])
+                        vertexChanged |= counters.merge(counter, counters.getCounter(neighbour));
+
+                nextChanged[vertex] = vertexChanged;
+                if (vertexChanged) {
+                    double estimate = counters.estimate(counter);
+                    if (estimate > estimates[vertex])
+                        neighbourhoodFunction.harmonicCentralities[vertex] += (estimate-estimates[vertex])/distance;
+                    estimates[vertex] = estimate;
+                    chunkChangedNumber++;
+                }
+                chunkPairNumber += estimates[vertex];
+            }
+            chunkPairNumbers[chunk] = chunkPairNumber;
+            chunkChangedNumbers[chunk] = chunkChangedNumber;
+        }, chunkNumber);
+
+        size_t changedNumber = 0;
+        for (size_t chunk=0; chunk<chunkNumber; chunk++)
+            changedNumber += chunkChangedNumbers[chunk];
+        if (changedNumber == 0)
+            break;
+
+        pairNumber = 0;
+        for (size_t chunk=0; chunk<chunkNumber; chunk++)
+            pairNumber += chunkPairNumbers[chunk];
+        neighbourhoodFunction.pairNumbers.push_back(pairNumber);
+
+        counters.swap(nextCounters);
+        changed.swap(nextChanged);
+    }
+    return neighbourhoodFunction;
+}
+
+vector<double> NeighbourhoodFunction::getDistanceDistribution() const {
+    vector<double> distribution(pairNumbers.size(), 0);
+    double reachablePairNumber = pairNumbers.empty() ? 0 : pairNumbers.back()-pairNumbers[0];
+    if (reachablePairNumber <= 0)
+        return distribution;
+
+    for (size_t distance=1; distance<pairNumbers.size(); distance++)
+        distribution[distance] = (pairNumbers[distance]-pairNumbers[distance-1])/reachablePairNumber;
+    return distribution;
+}
+
+double NeighbourhoodFunction::getAverageDistance() const {
+    double averageDistance = 0;
+    vector<double> distribution = getDistanceDistribution();
+    for (size_t distance=1; distance<distribution.size(); distance++)
+        averageDistance += distance*distribution[distance];
+    return averageDistance;
+}
+
+double NeighbourhoodFunction::getEffectiveDiameter(double fraction) const {
+    if (fraction <= 0 || fraction > 1)
+        throw invalid_argument("The fraction of pairs must be in (0, 1].");
+    double reachablePairNumber = pairNumbers.empty() ? 0 : pairNumbers.back()-pairNumbers[0];
+    if (reachablePairNumber <= 0)
+        return 0;
+
+    double targetPairNumber = pairNumbers[0] + fraction*reachablePairNumber;
+    size_t distance = 1;
+    while (distance < pairNumbers.size()-1 && pairNumbers[distance] < targetPairNumber)
+        distance++;
+    double increment = pairNumbers[distance]-pairNumbers[distance-1];
+    if (increment <= 0)
+        return distance;
+    return distance-1 + (targetPairNumber-pairNumbers[distance-1])/increment;
+}
+
+
+template NeighbourhoodFunction estimateNeighbourhoodFunction(const DirectedGraph& graph, size_t log2RegisterNumber, size_t threadNumber);
+template NeighbourhoodFunction estimateNeighbourhoodFunction(const UndirectedGraph& graph, size_t log2RegisterNumber, size_t threadNumber);
+
+} // namespace BaseGraph
@@ -0,0 +1,573 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "BaseGraph/algorithms/prunedlandmarklabeling.h"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+static const char PLL_FILE_TAG[16] = "BaseGraphPLL1";
+static const uint16_t INFINITE_DISTANCE = UINT16_MAX;
+static const uint32_t LABEL_END = UINT32_MAX;
+
+typedef vector<vector<pair<uint32_t, uint16_t>>> LabelLists;
+
+const size_t PrunedLandmarkLabeling::DEFAULT_BIT_PARALLEL_ROOTS;
+
+
+// Adjacency lists of the vertices renumbered by rank
+struct RankedAdjacency {
+    vector<size_t> offsets;
+    vector<uint32_t> neighbours;
+
+    const uint32_t* begin(uint32_t vertex) const { return neighbours.data()+offsets[vertex]; }
+    const uint32_t* end(uint32_t vertex) const { return neighbours.data()+offsets[vertex+1]; }
+};
+
+static RankedAdjacency getRankedAdjacency(const AdjacencyLists& adjacencyLists, const vector<uint32_t>& ranks) {
+    RankedAdjacency adjacency;
+    size_t verticesNumber = adjacencyLists.size();
+    adjacency.offsets.assign(verticesNumber+1, 0);
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+        adjacency.offsets[ranks[vertex]+1] = adjacencyLists[vertex].size();
+    for (size_t rank=0; rank<verticesNumber; rank++)
+        adjacency.offsets[rank+1] += adjacency.offsets[rank];
+
+    adjacency.neighbours.resize(adjacency.offsets[verticesNumber]);
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++) {
+        uint32_t* neighbours = adjacency.neighbours.data()+adjacency.offsets[ranks[vertex]];
+        for (const VertexIndex& neighbour: adjacencyLists[vertex])
+            *neighbours++ = ranks[neighbour];
+    }
+    return adjacency;
+}
+
+// Ranks by decreasing degree, ties broken by vertex index
+static vector<uint32_t> getRanks(const vector<size_t>& degrees) {
+    size_t verticesNumber = degrees.size();
+    if (verticesNumber >= LABEL_END)
+        throw invalid_argument("The graph has too many vertices for 32 bits labels.");
+
+    vector<VertexIndex> order(verticesNumber);
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+        order[vertex] = vertex;
+    sort(order.begin(), order.end(), [&](VertexIndex vertex1, VertexIndex vertex2) {
+        return degrees[vertex1] > degrees[vertex2] || (degrees[vertex1] == degrees[vertex2] && vertex1 < vertex2);
+    });
+
+    vector<uint32_t> ranks(verticesNumber);
+    for (size_t rank=0; rank<verticesNumber; rank++)
+        ranks[order[rank]] = rank;
+    return ranks;
+}
+
+static uint16_t getNextDistance(uint16_t distance) {
+    if (distance+1 >= INFINITE_DISTANCE)
+        throw overflow_error("Distances longer than 65534 cannot be stored in the labels.");
+    return distance+1;
+}
+
+// Distance from the labels of two vertices: the labels are sorted by hub and end with LABEL_END
+static size_t mergeLabels(const uint32_t* hubs1, const uint16_t* distances1, const uint32_t* hubs2, const uint16_t* distances2) {
+    size_t distance = SIZE_T_MAX;
+    while (true) {
+        if (*hubs1 == *hubs2) {
+            if (*hubs1 == LABEL_END)
+                break;
+            distance = min(distance, (size_t) *distances1 + *distances2);
+            hubs1++; distances1++;
+            hubs2++; distances2++;
+        }
+        else if (*hubs1 < *hubs2) {
+            hubs1++; distances1++;
+        }
+        else {
+            hubs2++; distances2++;
+        }
+    }
+    return distance;
+}
+
+// Distance through the bit-parallel root and its neighbours. The first set of a vertex
+// holds the neighbours one step closer than the root, the second set the neighbours at
+// the same distance.
+static size_t getBitParallelDistance(uint16_t distance1, const uint64_t* sets1, uint16_t distance2, const uint64_t* sets2) {
+    if (distance1 == INFINITE_DISTANCE || distance2 == INFINITE_DISTANCE)
+        return SIZE_T_MAX;
+    size_t distance = (size_t) distance1 + distance2;
+    if (sets1[0] & sets2[0])
+        distance -= 2;
+    else if ((sets1[0] & sets2[1]) | (sets1[1] & sets2[0]))
+        distance -= 1;
+    return distance;
+}
+
+
+// Builds the labels of an undirected graph in rank space. Vertices used by the
+// bit-parallel searches are not roots of pruned searches, since the bit-parallel
+// labels give their distances.
+static void buildUndirectedLabels(const RankedAdjacency& adjacency, size_t bitParallelRootNumber, LabelLists& labels,
+        vector<uint64_t>& bitParallelSets, vector<uint16_t>& bitParallelDistances) {
+    size_t verticesNumber = adjacency.offsets.size()-1;
+    size_t rootNumber = bitParallelRootNumber;
+    bitParallelSets.assign(verticesNumber*rootNumber*2, 0);
+    bitParallelDistances.assign(verticesNumber*rootNumber, INFINITE_DISTANCE);
+
+    vector<bool> used(verticesNumber, false);
+    vector<uint16_t> distances(verticesNumber);
+    vector<pair<uint64_t, uint64_t>> sets(verticesNumber);
+    vector<uint32_t> queue;
+    vector<pair<uint32_t, uint32_t>> siblingEdges, childEdges;
+
+    uint32_t root = 0;
+    for (size_t i=0; i<rootNumber; i++) {
+        while (root < verticesNumber && used[root])
+            root++;
+        if (root == verticesNumber)
+            break;
+
+        fill(distances.begin(), distances.end(), INFINITE_DISTANCE);
+        fill(sets.begin(), sets.end(), make_pair(0, 0));
+        used[root] = true;
+        distances[root] = 0;
+        queue.assign(1, root);
+
+        size_t neighbourNumber = 0;
+        for (const uint32_t* neighbour=adjacency.begin(root); neighbour!=adjacency.end(root) && neighbourNumber<64; neighbour++) {
+            if (!used[*neighbour]) {
+                used[*neighbour] = true;
+                distances[*neighbour] = 1;
+                sets[*neighbour].first = uint64_t(1) << neighbourNumber++;
+                queue.push_back(*neighbour);
+            }
+        }
+
+        size_t levelBegin = 0, levelEnd = 1;
+        for (uint16_t distance=0; levelBegin<queue.size(); distance++) {
+            siblingEdges.clear();
+            childEdges.clear();
+            for (size_t j=levelBegin; j<levelEnd; j++) {
+                uint32_t vertex = queue[j];
+                for (const uint32_t* neighbour=adjacency.begin(vertex); neighbour!=adjacency.end(vertex); neighbour++) {
+                    if (distances[*neighbour] < distance)
+                        continue;
+                    if (distances[*neighbour] == distance) {
+                        if (vertex < *neighbour)
+                            siblingEdges.push_back({vertex, *neighbour});
+                    }
+                    else {
+                        if (distances[*neighbour] == INFINITE_DISTANCE) {
+                            distances[*neighbour] = getNextDistance(distance);
+                            queue.push_back(*neighbour);
+                        }
+                        childEdges.push_back({vertex, *neighbour});
+                    }
+                }
+            }
+            for (auto& edge: siblingEdges) {
+                sets[edge.first].second |= sets[edge.second].first;
+                sets[edge.second].second |= sets[edge.first].first;
+            }
+            for (auto& edge: childEdges) {
+                sets[edge.second].first |= sets[edge.first].first;
+                sets[edge.second].second |= sets[edge.first].second;
+            }
+            levelBegin = levelEnd;
+            levelEnd = queue.size();
+        }
+
+        for (uint32_t vertex=0; vertex<verticesNumber; vertex++) {
+            bitParallelDistances[vertex*rootNumber+i] = distances[vertex];
+            bitParallelSets[(vertex*rootNumber+i)*2] = sets[vertex].first;
+            bitParallelSets[(vertex*rootNumber+i)*2+1] = sets[vertex].second;
+        }
+    }
+
+    labels.assign(verticesNumber, {});
+    vector<uint16_t> rootLabelDistances(verticesNumber, INFINITE_DISTANCE);
+    fill(distances.begin(), distances.end(), INFINITE_DISTANCE);
+
+    for (root=0; root<verticesNumber; root++) {
+        if (used[root])
+            continue;
+        for (auto& entry: labels[root])
+            rootLabelDistances[entry.first] = entry.second;
+        const uint16_t* rootBitParallelDistances = &bitParallelDistances[root*rootNumber];
+        const uint64_t* rootBitParallelSets = &bitParallelSets[root*rootNumber*2];
+
+        distances[root] = 0;
+        queue.assign(1, root);
+        for (size_t j=0; j<queue.size(); j++) {
+            uint32_t vertex = queue[j];
+            uint16_t distance = distances[vertex];
+
+            bool pruned = false;
+            for (size_t i=0; i<rootNumber && !pruned; i++)
+                pruned = getBitParallelDistance(rootBitParallelDistances[i], rootBitParallelSets+2*i,
+                        bitParallelDistances[vertex*rootNumber+i], &bitParallelSets[(vertex*rootNumber+i)*2]) <= distance;
+            for (auto it=labels[vertex].begin(); it!=labels[vertex].end() && !pruned; ++it)
+                pruned = rootLabelDistances[it->first] != INFINITE_DISTANCE && (size_t) rootLabelDistances[it->first]+it->second <= distance;
+            if (pruned)
+                continue;
+
+            labels[vertex].push_back({root, distance});
+            for (const uint32_t* neighbour=adjacency.begin(vertex); neighbour!=adjacency.end(vertex); neighbour++) {
+                if (distances[*neighbour] == INFINITE_DISTANCE) {
+                    distances[*neighbour] = getNextDistance(distance);
+                    queue.push_back(*neighbour);
+                }
+            }
+        }
+
+        for (uint32_t vertex: queue)
+            distances[vertex] = INFINITE_DISTANCE;
+        for (auto& entry: labels[root])
+            rootLabelDistances[entry.first] = INFINITE_DISTANCE;
+    }
+}
+
+// Pruned search from root along the edges of searchAdjacency. The labels of the
+// reached vertices are reachedLabels and the root label is rootLabels[root].
+static void runPrunedSearch(uint32_t root, const RankedAdjacency& searchAdjacency, const LabelLists& rootLabels,
+        LabelLists& reachedLabels, vector<uint16_t>& distances, vector<uint16_t>& rootLabelDistances, vector<uint32_t>& queue) {
+    for (auto& entry: rootLabels[root])
+        rootLabelDistances[entry.first] = entry.second;
+
+    distances[root] = 0;
+    queue.assign(1, root);
+    for (size_t j=0; j<queue.size(); j++) {
+        uint32_t vertex = queue[j];
+        uint16_t distance = distances[vertex];
+
+        bool pruned = false;
+        for (auto it=reachedLabels[vertex].begin(); it!=reachedLabels[vertex].end() && !pruned; ++it)
+            pruned = rootLabelDistances[it->first] != INFINITE_DISTANCE && (size_t) rootLabelDistances[it->first]+it->second <= distance;
+        if (pruned)
+            continue;
+
+        reachedLabels[vertex].push_back({root, distance});
+        for (const uint32_t* neighbour=searchAdjacency.begin(vertex); neighbour!=searchAdjacency.end(vertex); neighbour++) {
+            if (distances[*neighbour] == INFINITE_DISTANCE) {
+                distances[*neighbour] = getNextDistance(distance);
+                queue.push_back(*neighbour);
+            }
+        }
+    }
+
+    for (uint32_t vertex: queue)
+        distances[vertex] = INFINITE_DISTANCE;
+    for (auto& entry: rootLabels[root])
+        rootLabelDistances[entry.first] = INFINITE_DISTANCE;
+}
+
+// inLabels[v] holds d(hub, v) and outLabels[v] holds d(v, hub)
+static void buildDirectedLabels(const RankedAdjacency& outAdjacency, const RankedAdjacency& inAdjacency,
+        LabelLists& inLabels, LabelLists& outLabels) {
+    size_t verticesNumber = outAdjacency.offsets.size()-1;
+    inLabels.assign(verticesNumber, {});
+    outLabels.assign(verticesNumber, {});
+
+    vector<uint16_t> distances(verticesNumber, INFINITE_DISTANCE), rootLabelDistances(verticesNumber, INFINITE_DISTANCE);
+    vector<uint32_t> queue;
+    for (uint32_t root=0; root<verticesNumber; root++) {
+        runPrunedSearch(root, outAdjacency, outLabels, inLabels, distances, rootLabelDistances, queue);
+        runPrunedSearch(root, inAdjacency, inLabels, outLabels, distances, rootLabelDistances, queue);
+    }
+}
+
+
+static size_t getPaddedSize(size_t bytes) {
+    return (bytes+7)/8*8;
+}
+
+static size_t getLabelsSize(size_t verticesNumber, size_t entryNumber) {
+    return getPaddedSize((verticesNumber+1)*sizeof(uint64_t)) + getPaddedSize(entryNumber*sizeof(uint32_t))
+        + getPaddedSize(entryNumber*sizeof(uint16_t));
+}
+
+static size_t countEntries(const LabelLists& labels) {
+    size_t entryNumber = 0;
+    for (auto& label: labels)
+        entryNumber += label.size()+1;
+    return entryNumber;
+}
+
+static char* writeLabels(char* data, const LabelLists& labels, size_t entryNumber) {
+    size_t verticesNumber = labels.size();
+    uint64_t* offsets = (uint64_t*) data;
+    uint32_t* hubs = (uint32_t*) (data + getPaddedSize((verticesNumber+1)*sizeof(uint64_t)));
+    uint16_t* distances = (uint16_t*) ((char*) hubs + getPaddedSize(entryNumber*sizeof(uint32_t)));
+
+    offsets[0] = 0;
+    for (size_t vertex=0; vertex<verticesNumber; vertex++) {
+        size_t position = offsets[vertex];
+        for (auto& entry: labels[vertex]) {
+            hubs[position] = entry.first;
+            distances[position++] = entry.second;
+        }
+        hubs[position] = LABEL_END;
+        distances[position++] = INFINITE_DISTANCE;
+        offsets[vertex+1] = position;
+    }
+    return data + getLabelsSize(verticesNumber, entryNumber);
+}
+
+static vector<uint64_t> createBuffer(const vector<uint32_t>& ranks, bool directed, size_t bitParallelRootNumber,
+        const LabelLists& inLabels, const LabelLists& outLabels,
+        const vector<uint64_t>& bitParallelSets, const vector<uint16_t>& bitParallelDistances) {
+    size_t verticesNumber = ranks.size();
+    size_t inEntryNumber = countEntries(inLabels), outEntryNumber = directed ? countEntries(outLabels) : 0;
+
+    size_t size = getPaddedSize(sizeof(PLL_FILE_TAG) + 5*sizeof(uint64_t)) + getPaddedSize(verticesNumber*sizeof(uint32_t))
+        + getLabelsSize(verticesNumber, inEntryNumber) + (directed ? getLabelsSize(verticesNumber, outEntryNumber) : 0)
+        + getPaddedSize(bitParallelSets.size()*sizeof(uint64_t)) + getPaddedSize(bitParallelDistances.size()*sizeof(uint16_t));
+    vector<uint64_t> buffer(size/sizeof(uint64_t), 0);
+    char* data = (char*) buffer.data();
+
+    uint64_t header[5] = {verticesNumber, directed, bitParallelRootNumber, inEntryNumber, outEntryNumber};
+    memcpy(data, PLL_FILE_TAG, sizeof(PLL_FILE_TAG));
+    memcpy(data+sizeof(PLL_FILE_TAG), header, sizeof(header));
+    data += getPaddedSize(sizeof(PLL_FILE_TAG) + sizeof(header));
+
+    memcpy(data, ranks.data(), verticesNumber*sizeof(uint32_t));
+    data += getPaddedSize(verticesNumber*sizeof(uint32_t));
+    data = writeLabels(data, inLabels, inEntryNumber);
+    if (directed)
+        data = writeLabels(data, outLabels, outEntryNumber);
+
+    memcpy(data, bitParallelSets.data(), bitParallelSets.size()*sizeof(uint64_t));
+    data += getPaddedSize(bitParallelSets.size()*sizeof(uint64_t));
+    memcpy(data, bitParallelDistances.data(), bitParallelDistances.size()*sizeof(uint16_t));
+    return buffer;
+}
+
+
+PrunedLandmarkLabeling::PrunedLandmarkLabeling(const UndirectedGraph& graph, size_t bitParallelRootNumber) {
+    size_t verticesNumber = graph.getSize();
+    if (bitParallelRootNumber > verticesNumber)
+        bitParallelRootNumber = verticesNumber;
+
+    AdjacencyLists adjacencyLists(verticesNumber);
+    for (VertexIndex vertex: graph)
+        adjacencyLists[vertex] = graph.getNeighboursOfIdx(vertex);
+    vector<uint32_t> ranks = getRanks(graph.getDegrees());
+    RankedAdjacency adjacency = getRankedAdjacency(adjacencyLists, ranks);
+
+    LabelLists labels;
+    vector<uint64_t> bitParallelSets;
+    vector<uint16_t> bitParallelDistances;
+    buildUndirectedLabels(adjacency, bitParallelRootNumber, labels, bitParallelSets, bitParallelDistances);
+
+    buffer = createBuffer(ranks, false, bitParallelRootNumber, labels, labels, bitParallelSets, bitParallelDistances);
+    setPointers();
+}
+
+PrunedLandmarkLabeling::PrunedLandmarkLabeling(const DirectedGraph& graph) {
+    size_t verticesNumber = graph.getSize();
+
+    AdjacencyLists outEdges(verticesNumber);
+    vector<size_t> degrees = graph.getOutDegrees();
+    for (VertexIndex vertex: graph) {
+        outEdges[vertex] = graph.getOutEdgesOfIdx(vertex);
+        for (const VertexIndex& neighbour: outEdges[vertex])
+            degrees[neighbour]++;
+    }
+    vector<uint32_t> ranks = getRanks(degrees);
+    RankedAdjacency outAdjacency = getRankedAdjacency(outEdges, ranks);
+    RankedAdjacency inAdjacency = getRankedAdjacency(graph.getInEdges(), ranks);
+
+    LabelLists inLabels, outLabels;
+    buildDirectedLabels(outAdjacency, inAdjacency, inLabels, outLabels);
+
+    buffer = createBuffer(ranks, true, 0, inLabels, outLabels, {}, {});
+    setPointers();
+}
+
+
+void PrunedLandmarkLabeling::setPointers() {
+    static const Header emptyHeader = {{0}, 0, 0, 0, 0, 0};
+    if (buffer.empty() && !mapping.isOpen()) {
+        header = &emptyHeader;
+        vertexRanks = nullptr;
+        inLabels = outLabels = {nullptr, nullptr, nullptr};
+        bitParallelSets = nullptr;
+        bitParallelDistances = nullptr;
+    }
+    else if (!mapping.isOpen())
+        setPointers((const char*) buffer.data(), buffer.size()*sizeof(uint64_t));
+    else
+        setPointers((const char*) mapping.getData(), mapping.getSize());
+}
+
+void PrunedLandmarkLabeling::setPointers(const char* data, size_t size) {
+    if (size < sizeof(Header) || strncmp(data, PLL_FILE_TAG, sizeof(PLL_FILE_TAG)) != 0)
+        throw runtime_error("File does not contain a pruned landmark labeling.");
+
+    const Header* fileHeader = (const Header*) data;
+    size_t verticesNumber = fileHeader->verticesNumber, rootNumber = fileHeader->bitParallelRootNumber;
+    if (verticesNumber >= LABEL_END || fileHeader->inEntryNumber > size || fileHeader->outEntryNumber > size
+            || rootNumber > verticesNumber || fileHeader->directed > 1
+            || (rootNumber > 0 && verticesNumber > size/(rootNumber*2*sizeof(uint64_t))))
+        throw runtime_error("Corrupted pruned landmark labeling.");
+
+    size_t expectedSize = getPaddedSize(sizeof(Header)) + getPaddedSize(verticesNumber*sizeof(uint32_t))
+        + getLabelsSize(verticesNumber, fileHeader->inEntryNumber)
+        + (fileHeader->directed ? getLabelsSize(verticesNumber, fileHeader->outEntryNumber) : 0)
+        + getPaddedSize(verticesNumber*rootNumber*2*sizeof(uint64_t)) + getPaddedSize(verticesNumber*rootNumber*sizeof(uint16_t));
+    if (size != expectedSize)
+        throw runtime_error("Corrupted pruned landmark labeling.");
+
+    auto readLabels = [&](const char* labelsData, size_t entryNumber) -> Labels {
+        Labels labels;
+        labels.offsets = (const uint64_t*) labelsData;
+        labels.hubs = (const uint32_t*) (labelsData + getPaddedSize((verticesNumber+1)*sizeof(uint64_t)));
+        labels.distances = (const uint16_t*) ((const char*) labels.hubs + getPaddedSize(entryNumber*sizeof(uint32_t)));
+        if (labels.offsets[verticesNumber] != entryNumber)
+            throw runtime_error("Corrupted pruned landmark labeling.");
+        return labels;
+    };
+
+    const char* position = data + getPaddedSize(sizeof(Header));
+    const uint32_t* ranks = (const uint32_t*) position;
+    position += getPaddedSize(verticesNumber*sizeof(uint32_t));
+    Labels fileInLabels = readLabels(position, fileHeader->inEntryNumber);
+    position += getLabelsSize(verticesNumber, fileHeader->inEntryNumber);
+    Labels fileOutLabels = fileInLabels;
+    if (fileHeader->directed) {
+        fileOutLabels = readLabels(position, fileHeader->outEntryNumber);
+        position += getLabelsSize(verticesNumber, fileHeader->outEntryNumber);
+    }
+
+    header = fileHeader;
+    vertexRanks = ranks;
+    inLabels = fileInLabels;
+    outLabels = fileOutLabels;
+    bitParallelSets = (const uint64_t*) position;
+    bitParallelDistances = (const uint16_t*) (position + getPaddedSize(verticesNumber*rootNumber*2*sizeof(uint64_t)));
+}
+
+// Every label must lie within the entries, hold increasing hubs (which are ranks)
+// and end with LABEL_END, so that the queries never read past it.
+static bool areValidLabels(const uint64_t* offsets, const uint32_t* hubs, size_t verticesNumber) {
+    if (offsets[0] != 0)
+        return false;
+    for (size_t rank=0; rank<verticesNumber; rank++) {
+        uint64_t begin = offsets[rank], end = offsets[rank+1];
+        if (end <= begin || end > offsets[verticesNumber] || hubs[end-1] != LABEL_END)
+            return false;
+        for (uint64_t i=begin; i<end-1; i++)
+            if (hubs[i] >= verticesNumber || (i > begin && hubs[i] <= hubs[i-1]))
+                return false;
+    }
+    return true;
+}
+
+// The sizes are checked by setPointers, the content of a loaded or mapped file here
+void PrunedLandmarkLabeling::validateContent() const {
+    size_t verticesNumber = header->verticesNumber;
+    for (size_t vertex=0; vertex<verticesNumber; vertex++)
+        if (vertexRanks[vertex] >= verticesNumber)
+            throw runtime_error("Corrupted pruned landmark labeling.");
+    if (!areValidLabels(inLabels.offsets, inLabels.hubs, verticesNumber)
+            || (header->directed && !areValidLabels(outLabels.offsets, outLabels.hubs, verticesNumber)))
+        throw runtime_error("Corrupted pruned landmark labeling.");
+}
+
+void PrunedLandmarkLabeling::assertVertexInRange(VertexIndex vertex) const {
+    if (vertex >= header->verticesNumber)
+        throw out_of_range("Vertex index (" + to_string(vertex) +
+                ") greater than the graph's size("+ to_string(header->verticesNumber) +").");
+}
+
+size_t PrunedLandmarkLabeling::getDistanceIdx(VertexIndex vertex1, VertexIndex vertex2) const {
+    assertVertexInRange(vertex1);
+    assertVertexInRange(vertex2);
+    if (vertex1 == vertex2)
+        return 0;
+
+    uint32_t rank1 = vertexRanks[vertex1], rank2 = vertexRanks[vertex2];
+    size_t rootNumber = header->bitParallelRootNumber;
+
+    size_t distance = SIZE_T_MAX;
+    for (size_t i=0; i<rootNumber; i++)
+        distance = min(distance, getBitParallelDistance(
+                    bitParallelDistances[rank1*rootNumber+i], &bitParallelSets[(rank1*rootNumber+i)*2],
+                    bitParallelDistances[rank2*rootNumber+i], &bitParallelSets[(rank2*rootNumber+i)*2]));
+
+    return min(distance, mergeLabels(outLabels.hubs+outLabels.offsets[rank1], outLabels.distances+outLabels.offsets[rank1],
+                inLabels.hubs+inLabels.offsets[rank2], inLabels.distances+inLabels.offsets[rank2]));
+}
+
+size_t PrunedLandmarkLabeling::getLabelEntryNumber() const {
+    // Each label ends with a marker
+    size_t entryNumber = header->inEntryNumber - header->verticesNumber;
+    if (header->directed)
+        entryNumber += header->outEntryNumber - header->verticesNumber;
+    return entryNumber;
+}
+
+
+void PrunedLandmarkLabeling::writeInBinaryFile(const string& fileName) const {
+    if (buffer.empty() && !mapping.isOpen())
+        throw logic_error("The index is empty.");
+
+    ofstream fileStream(fileName, ios::binary);
+    if (!fileStream.is_open())
+        throw runtime_error("Could not open file.");
+    if (mapping.isOpen())
+        fileStream.write((const char*) mapping.getData(), mapping.getSize());
+    else
+        fileStream.write((const char*) buffer.data(), buffer.size()*sizeof(uint64_t));
+}
+
+void PrunedLandmarkLabeling::loadFromBinaryFile(const string& fileName) {
+    ifstream fileStream(fileName, ios::binary | ios::ate);
+    if (!fileStream.is_open())
+        throw runtime_error("Could not open file.");
+
+    size_t size = fileStream.tellg();
+    if (size % sizeof(uint64_t) != 0)
+        throw runtime_error("Corrupted pruned landmark labeling.");
+    PrunedLandmarkLabeling loaded;
+    loaded.buffer.resize(size/sizeof(uint64_t));
+    fileStream.seekg(0);
+    fileStream.read((char*) loaded.buffer.data(), size);
+    if (!fileStream)
+        throw runtime_error("Corrupted pruned landmark labeling.");
+
+    loaded.setPointers();
+    loaded.validateContent();
+    swap(loaded);
+}
+
+void PrunedLandmarkLabeling::mapBinaryFile(const string& fileName) {
+    if (!MappedFile::isSupported()) {
+        loadFromBinaryFile(fileName);
+        return;
+    }
+    PrunedLandmarkLabeling mapped;
+    mapped.mapping = MappedFile::openReadOnly(fileName);
+    mapped.setPointers();
+    mapped.validateContent();
+    swap(mapped);
+}
+
+void PrunedLandmarkLabeling::swap(PrunedLandmarkLabeling& other) {
+    std::swap(buffer, other.buffer);
+    mapping.swap(other.mapping);
+    std::swap(header, other.header);
+    std::swap(vertexRanks, other.vertexRanks);
+    std::swap(inLabels, other.inLabels);
+    std::swap(outLabels, other.outLabels);
+    std::swap(bitParallelSets, other.bitParallelSets);
+    std::swap(bitParallelDistances, other.bitParallelDistances);
+}
+
+} // namespace BaseGraph
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "BaseGraph/algorithms/triangles.h"
+#include "BaseGraph/parallel.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+const size_t TriangleEnumerator::GALLOPING_RATIO;
+
+
+TriangleEnumerator::TriangleEnumerator(const UndirectedGraph& graph): verticesNumber(graph.getSize()) {
+    vector<size_t> degrees = graph.getDegrees();
+    auto precedes = [&](VertexIndex vertex1, VertexIndex vertex2) {
+        return degrees[vertex1] < degrees[vertex2] || (degrees[vertex1] == degrees[vertex2] && vertex1 < vertex2);
+    };
+
+    outOffsets.assign(verticesNumber+1, 0);
+    for (VertexIndex vertex: graph) {
+        outOffsets[vertex+1] = outOffsets[vertex];
+        for (const VertexIndex& neighbour: graph.getNeighboursOfIdx(vertex))
+            if (precedes(vertex, neighbour))
+                outOffsets[vertex+1]++;
+    }
+
+    outNeighbours.resize(outOffsets[verticesNumber]);
+    for (VertexIndex vertex: graph) {
+        auto begin = outNeighbours.begin()+outOffsets[vertex], end = begin;
+        for (const VertexIndex& neighbour: graph.getNeighboursOfIdx(vertex))
+            if (precedes(vertex, neighbour))
+                *end++ = neighbour;
+        sort(begin, end);
+    }
+
+    // Removes the duplicate edges
+    size_t position = 0;
+    for (VertexIndex vertex: graph) {
+        size_t begin = outOffsets[vertex];
+        outOffsets[vertex] = position;
+        for (size_t i=begin; i<outOffsets[vertex+1]; i++)
+            if (i == begin || outNeighbours[i] != outNeighbours[i-1])
+                outNeighbours[position++] = outNeighbours[i];
+    }
+    outOffsets[verticesNumber] = position;
+    outNeighbours.resize(position);
+    outNeighbours.shrink_to_fit();
+}
+
+// Calls function(x) for every x of the sorted range [first, firstEnd) found in the
+// much longer sorted range [second, secondEnd), by exponential then binary search.
+template <typename Function>
+static void gallopingIntersection(const VertexIndex* first, const VertexIndex* firstEnd,
+        const VertexIndex* second, const VertexIndex* secondEnd, Function function) {
+    for (; first != firstEnd && second != secondEnd; first++) {
+        size_t step = 1;
+        while (step < size_t(secondEnd-second) && second[step] < *first)
+            step *= 2;
+        second = lower_bound(second+step/2, min(second+step+1, secondEnd), *first);
+        if (second != secondEnd && *second == *first)
+            function(*first);
+    }
+}
+
+// Both positions advance without branching on the comparison, which the processor
+// cannot predict for random neighbours.
+template <typename Function>
+static void mergingIntersection(const VertexIndex* first, const VertexIndex* firstEnd,
+        const VertexIndex* second, const VertexIndex* secondEnd, Function function) {
+    while (first != firstEnd && second != secondEnd) {
+        VertexIndex value1 = *first, value2 = *second;
+        if (value1 == value2)
+            function(value1);
+        first += value1 <= value2;
+        second += value2 <= value1;
+    }
+}
+
+template <typename Function>
+void TriangleEnumerator::forEachTriangleOfVertexIdx(VertexIndex vertex1, Function function) const {
+    const VertexIndex* neighbours1 = outNeighbours.data()+outOffsets[vertex1];
+    const VertexIndex* neighbours1End = outNeighbours.data()+outOffsets[vertex1+1];
+
+    for (const VertexIndex* vertex2=neighbours1; vertex2!=neighbours1End; vertex2++) {
+        const VertexIndex* neighbours2 = outNeighbours.data()+outOffsets[*vertex2];
+        const VertexIndex* neighbours2End = outNeighbours.data()+outOffsets[*vertex2+1];
+        size_t size1 = neighbours1End-neighbours1, size2 = neighbours2End-neighbours2;
+        auto onCommonNeighbour = [&](VertexIndex vertex3) { function(vertex1, *vertex2, vertex3); };
+
+        if (size2 > GALLOPING_RATIO*size1)
+            gallopingIntersection(neighbours1, neighbours1End, neighbours2, neighbours2End, onCommonNeighbour);
+        else if (size1 > GALLOPING_RATIO*size2)
+            gallopingIntersection(neighbours2, neighbours2End, neighbours1, neighbours1End, onCommonNeighbour);
+        else
+            mergingIntersection(neighbours1, neighbours1End, neighbours2, neighbours2End, onCommonNeighbour);
+    }
+}
+
+// Each thread counts in its own vector while taking batches of vertices from a shared
+// counter, and the vectors are summed at the end.
+TriangleCounts TriangleEnumerator::countTriangles(size_t threadNumber) const {
+    const size_t BATCH_SIZE = 256;
+    size_t batchNumber = (verticesNumber+BATCH_SIZE-1)/BATCH_SIZE;
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    threadNumber = max(min(threadNumber, batchNumber), (size_t) 1);
+
+    TriangleCounts counts;
+    counts.vertexTriangleNumbers.assign(verticesNumber, 0);
+    atomic<size_t> nextBatch(0);
+    mutex countsMutex;
+
+    parallelFor(0, threadNumber, [&](size_t) {
+        size_t triangleNumber = 0;
+        vector<size_t> vertexTriangleNumbers;
+        vector<size_t>& threadCounts = threadNumber == 1 ? counts.vertexTriangleNumbers : vertexTriangleNumbers;
+        threadCounts.resize(verticesNumber, 0);
+
+        for (size_t batch=nextBatch++; batch<batchNumber; batch=nextBatch++)
+            for (VertexIndex vertex=batch*BATCH_SIZE; vertex<min((batch+1)*BATCH_SIZE, verticesNumber); vertex++)
+                forEachTriangleOfVertexIdx(vertex, [&](VertexIndex vertex1, VertexIndex vertex2, VertexIndex vertex3) {
+                    triangleNumber++;
+                    threadCounts[vertex1]++;
+                    threadCounts[vertex2]++;
+                    threadCounts[vertex3]++;
+                });
+
+        lock_guard<mutex> lock(countsMutex);
+        counts.triangleNumber += triangleNumber;
+        if (threadNumber != 1)
+            for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+                counts.vertexTriangleNumbers[vertex] += vertexTriangleNumbers[vertex];
+    }, threadNumber);
+    return counts;
+}
+
+list<array<VertexIndex, 3>> TriangleEnumerator::findAllTriangles() const {
+    vector<array<VertexIndex, 3>> triangles;
+    for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+        forEachTriangleOfVertexIdx(vertex, [&](VertexIndex vertex1, VertexIndex vertex2, VertexIndex vertex3) {
+            array<VertexIndex, 3> triangle = {vertex1, vertex2, vertex3};
+            sort(triangle.begin(), triangle.end());
+            triangles.push_back(triangle);
+        });
+    sort(triangles.begin(), triangles.end());
+    return list<array<VertexIndex, 3>>(triangles.begin(), triangles.end());
+}
+
+} // namespace BaseGraph
@@ -1,4 +1,5 @@
 #include "BaseGraph/metrics/directed.h"
+#include "BaseGraph/parallel.hpp"
 #include <algorithm>
 #include <array>
 #include <map>
@@ -33,17 +34,16 @@ double getReciprocity(const DirectedGraph& graph) {
     return reciprocalEdgeNumber / (double) graph.getEdgeNumber();
 }
 
+// Each vertex counts its own reciprocal out edges, so that the vertices can be
+// split between threads without sharing any count.
 vector<size_t> getReciprocalDegrees(const DirectedGraph& graph) {
     vector<size_t> reciprocities(graph.getSize(), 0);
 
-    for (const VertexIndex& vertex: graph) {
-        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
-            if (vertex < neighbour && graph.isEdgeIdx(neighbour, vertex)) {
-                    reciprocities[vertex]++;
-                    reciprocities[neighbour]++;
-            }
-        }
-    }
+    parallelForDynamic(0, graph.getSize(), [&](VertexIndex vertex) {
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex))
+            if (neighbour != vertex && graph.isEdgeIdx(neighbour, vertex))
+                reciprocities[vertex]++;
+    }, getThreadNumber());
 
     return reciprocities;
 }
@@ -104,13 +104,11 @@ vector<double> getUndirectedLocalClusteringCoefficients(const DirectedGraph& gra
     }
 
 
-    size_t undirectedDegree;
-
-    for (const VertexIndex& vertex: graph) {
-        undirectedDegree = getUnionOfLists(graph.getOutEdgesOfIdx(vertex), inEdges[vertex]).size();
+    parallelForDynamic(0, graph.getSize(), [&](VertexIndex vertex) {
+        size_t undirectedDegree = getUnionOfLists(graph.getOutEdgesOfIdx(vertex), inEdges[vertex]).size();
         if (undirectedDegree>1)
             localClusteringCoefficients[vertex] /= undirectedDegree*(undirectedDegree-1)/2.;
-    }
+    }, getThreadNumber());
     return localClusteringCoefficients;
 }
 
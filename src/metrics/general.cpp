@@ -1,9 +1,20 @@
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <mutex>
 #include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 
 #include "BaseGraph/undirectedgraph.h"
 #include "BaseGraph/metrics/general.h"
+#include "BaseGraph/metrics/undirected.h"
 #include "BaseGraph/algorithms/graphpaths.h"
+#include "BaseGraph/algorithms/multisourcebfs.hpp"
+#include "BaseGraph/algorithms/randomgraphs.h"
+#include "BaseGraph/parallel.hpp"
 
 
 using namespace std;
@@ -12,219 +23,385 @@ using namespace std;
 namespace BaseGraph{
 
 
+// Per-source accumulators of getShortestPathMetrics. Each source is handled by a
+// single thread, which is the only one to write its values.
+struct SourceAccumulators {
+    vector<size_t> reachedNumbers;
+    vector<unsigned long long int> distanceSums;
+    vector<double> inverseDistanceSums;
+    vector<size_t> eccentricities;
+};
+
 template <typename T>
-static double getClosenessCentralityOfVertexIdx(const T& graph, VertexIndex vertexIdx){
-    vector<size_t> shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, vertexIdx);
-    size_t componentSize = 0;
-    unsigned long long int sum = 0;
-
-    for (VertexIndex& vertex: graph) {
-        if (shortestPathLengths[vertex] != SIZE_T_MAX){
-            componentSize += 1;
-            sum += shortestPathLengths[vertex];
+ShortestPathMetrics getShortestPathMetrics(const T& graph, unsigned int metrics, size_t threadNumber) {
+    size_t verticesNumber = graph.getSize();
+    bool needsSums = metrics & (CLOSENESS_CENTRALITIES | SHORTEST_PATH_AVERAGES);
+    bool needsInverseSums = metrics & (HARMONIC_CENTRALITIES | SHORTEST_PATH_HARMONIC_AVERAGES);
+    bool needsReachedNumbers = metrics & (CLOSENESS_CENTRALITIES | SHORTEST_PATH_AVERAGES | SHORTEST_PATH_HARMONIC_AVERAGES);
+    bool needsEccentricities = metrics & ECCENTRICITIES;
+    bool needsDistribution = metrics & SHORTEST_PATHS_DISTRIBUTION;
+
+    list<Component> connectedComponents;
+    vector<size_t> componentOfVertex;
+    if (needsDistribution) {
+        connectedComponents = findConnectedComponents(graph);
+        componentOfVertex.resize(verticesNumber);
+        size_t componentIndex = 0;
+        for (auto& component: connectedComponents) {
+            for (const VertexIndex& vertex: component)
+                componentOfVertex[vertex] = componentIndex;
+            componentIndex++;
+        }
+    }
+
+    SourceAccumulators accumulators;
+    accumulators.reachedNumbers.assign(needsReachedNumbers ? verticesNumber : 0, 0);
+    accumulators.distanceSums.assign(needsSums ? verticesNumber : 0, 0);
+    accumulators.inverseDistanceSums.assign(needsInverseSums ? verticesNumber : 0, 0);
+    accumulators.eccentricities.assign(needsEccentricities ? verticesNumber : 0, 0);
+
+    // The sources are searched by batches of 64, which the threads take from a shared
+    // counter. Each thread reuses its own search workspace for all of its batches. The
+    // path counts of a batch are added to pathCounts[component] at the end of the batch.
+    const size_t BATCH_SIZE = 64;
+    size_t batchNumber = (verticesNumber+BATCH_SIZE-1)/BATCH_SIZE;
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    threadNumber = max(min(threadNumber, batchNumber), (size_t) 1);
+
+    vector<vector<size_t>> pathCounts(connectedComponents.size());
+    mutex pathCountsMutex;
+    atomic<size_t> nextBatch(0);
+
+    parallelFor(0, threadNumber, [&](size_t) {
+        MultiSourceBFSWorkspace workspace;
+        vector<VertexIndex> sources;
+
+        for (size_t batch=nextBatch++; batch<batchNumber; batch=nextBatch++) {
+            VertexIndex batchBegin = batch*BATCH_SIZE, batchEnd = min(batchBegin+BATCH_SIZE, verticesNumber);
+            sources.clear();
+            for (VertexIndex vertex=batchBegin; vertex<batchEnd; vertex++)
+                sources.push_back(vertex);
+            vector<vector<size_t>> sourcePathCounts(needsDistribution ? sources.size() : 0);
+
+            multiSourceBreadthFirstSearch(graph, sources, [&](VertexIndex source, VertexIndex, size_t distance) {
+                if (distance == 0)
+                    return;
+                if (needsReachedNumbers)
+                    accumulators.reachedNumbers[source]++;
+                if (needsSums)
+                    accumulators.distanceSums[source] += distance;
+                if (needsInverseSums)
+                    accumulators.inverseDistanceSums[source] += 1.0/distance;
+                if (needsEccentricities && distance > accumulators.eccentricities[source])
+                    accumulators.eccentricities[source] = distance;
+                if (needsDistribution) {
+                    auto& counts = sourcePathCounts[source-batchBegin];
+                    if (counts.size() <= distance)
+                        counts.resize(distance+1, 0);
+                    counts[distance]++;
+                }
+            }, workspace);
+
+            if (needsDistribution) {
+                lock_guard<mutex> lock(pathCountsMutex);
+                for (VertexIndex source=batchBegin; source<batchEnd; source++) {
+                    auto& sourceCounts = sourcePathCounts[source-batchBegin];
+                    auto& counts = pathCounts[componentOfVertex[source]];
+                    if (counts.size() < sourceCounts.size())
+                        counts.resize(sourceCounts.size(), 0);
+                    for (size_t pathLength=1; pathLength<sourceCounts.size(); pathLength++)
+                        counts[pathLength] += sourceCounts[pathLength];
+                }
+            }
         }
+    }, threadNumber);
+
+    ShortestPathMetrics results;
+    if (metrics & CLOSENESS_CENTRALITIES) {
+        results.closenessCentralities.assign(verticesNumber, 0);
+        for (VertexIndex vertex: graph)
+            if (accumulators.distanceSums[vertex] > 0)
+                results.closenessCentralities[vertex] = (double) accumulators.reachedNumbers[vertex]/accumulators.distanceSums[vertex];
     }
-    return sum > 0 ? ((double) componentSize-1)/sum : 0;
+    if (metrics & HARMONIC_CENTRALITIES)
+        results.harmonicCentralities = accumulators.inverseDistanceSums;
+    if (metrics & SHORTEST_PATH_AVERAGES) {
+        results.shortestPathAverages.assign(verticesNumber, 0);
+        for (VertexIndex vertex: graph)
+            if (accumulators.reachedNumbers[vertex] > 0)
+                results.shortestPathAverages[vertex] = (double) accumulators.distanceSums[vertex]/accumulators.reachedNumbers[vertex];
+    }
+    if (metrics & SHORTEST_PATH_HARMONIC_AVERAGES) {
+        results.shortestPathHarmonicAverages.assign(verticesNumber, 0);
+        for (VertexIndex vertex: graph)
+            if (accumulators.reachedNumbers[vertex] > 0)
+                results.shortestPathHarmonicAverages[vertex] = accumulators.inverseDistanceSums[vertex]/accumulators.reachedNumbers[vertex];
+    }
+    if (needsEccentricities)
+        results.eccentricities = move(accumulators.eccentricities);
+
+    if (needsDistribution) {
+        results.shortestPathsDistribution.resize(connectedComponents.size());
+        size_t componentIndex = 0;
+        for (auto& component: connectedComponents) {
+            auto& counts = pathCounts[componentIndex];
+            for (size_t pathLength=1; pathLength<counts.size(); pathLength++)
+                if (counts[pathLength] > 0)
+                    results.shortestPathsDistribution[componentIndex][pathLength] = (double) counts[pathLength] / component.size();
+            componentIndex++;
+        }
+    }
+    return results;
 }
 
 template <typename T>
 vector<double> getClosenessCentralities(const T& graph) {
-    vector<double> closenessCentralities(graph.getSize(), 0);
-
-    for (VertexIndex vertex: graph)
-        closenessCentralities[vertex] = getClosenessCentralityOfVertexIdx(graph, vertex);
-
-    return closenessCentralities;
+    return getShortestPathMetrics(graph, CLOSENESS_CENTRALITIES, getThreadNumber()).closenessCentralities;
 }
 
 template <typename T>
-static double getHarmonicCentralityOfVertexIdx(const T& graph, VertexIndex vertexIdx) {
-    vector<size_t> shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, vertexIdx);
-
-    double harmonicSum = 0;
-    for (VertexIndex& vertex: graph)
-        if (shortestPathLengths[vertex] != 0 && shortestPathLengths[vertex] != SIZE_T_MAX)
-            harmonicSum += 1.0/shortestPathLengths[vertex];
-
-    return harmonicSum;
+vector<double> getHarmonicCentralities(const T& graph) {
+    return getShortestPathMetrics(graph, HARMONIC_CENTRALITIES, getThreadNumber()).harmonicCentralities;
 }
 
+// Single-source step of Brandes' algorithm (Brandes, 2001). The geodesics from the
+// source are counted during a breadth-first search, then the dependencies of the
+// vertices are accumulated by decreasing distance. Parallel edges are counted once,
+// like in the geodesics enumerated by findAllPredecessorsOfVertexIdx.
+//
+// With normalizeWithGeodesicNumber, a vertex receives the fraction of the geodesics
+// of each pair that goes through it. Otherwise, it receives the number of these
+// geodesics, that is pathNumbers[v] times the number of geodesics leaving v.
 template <typename T>
-vector<double> getHarmonicCentralities(const T& graph) {
-    vector<double> harmonicCentralities(graph.getSize(), 0);
-
-    for (VertexIndex vertex: graph)
-        harmonicCentralities[vertex] = getHarmonicCentralityOfVertexIdx(graph, vertex);
-
-    return harmonicCentralities;
-}
+class BrandesAccumulator {
+    public:
+        explicit BrandesAccumulator(const T& graph):
+            graph(graph), distances(graph.getSize(), SIZE_T_MAX), pathNumbers(graph.getSize(), 0),
+            dependencies(graph.getSize(), 0), stamps(graph.getSize(), 0) {}
+
+        // edgeBetweennesses has a value for each position of the adjacency lists,
+        // the list of vertex v starting at edgeOffsets[v].
+        void accumulate(VertexIndex source, bool normalizeWithGeodesicNumber, vector<double>& betweennesses,
+                vector<double>* edgeBetweennesses=nullptr, const vector<size_t>* edgeOffsets=nullptr);
+
+    private:
+        const T& graph;
+        vector<size_t> distances;
+        vector<double> pathNumbers;
+        vector<double> dependencies;
+        vector<size_t> stamps;
+        size_t currentStamp = 0;
+        vector<VertexIndex> visitedVertices;
+
+        // Returns false when the neighbour appeared earlier in the adjacency list being read
+        bool isFirstOccurrence(VertexIndex neighbour) {
+            if (stamps[neighbour] == currentStamp)
+                return false;
+            stamps[neighbour] = currentStamp;
+            return true;
+        }
+};
 
-template <>
-vector<double> getBetweennessCentralities(const DirectedGraph& graph, bool normalizeWithGeodesicNumber) {
-    size_t verticesNumber = graph.getSize();
-    vector<double> betweennesses;
-    betweennesses.resize(verticesNumber, 0);
-
-    MultiplePredecessors distancesPredecessors;
-    list<list<VertexIndex> > currentGeodesics;
-    for (const VertexIndex& i: graph) {
-        distancesPredecessors = findAllPredecessorsOfVertexIdx(graph, i);
-        for (const VertexIndex& j: graph) {
-            currentGeodesics = findMultiplePathsToVertexFromPredecessorsIdx(graph, i, j, distancesPredecessors);
-            if (currentGeodesics.empty()) continue; // vertices i and j are not in the same component
-
-            for (auto& geodesic: currentGeodesics) {
-                for (auto& vertexOnGeodesic: geodesic) {
-                    if (vertexOnGeodesic != i && vertexOnGeodesic != j) {
-                        if (normalizeWithGeodesicNumber)
-                            betweennesses[vertexOnGeodesic] += 1./currentGeodesics.size();
-                        else
-                            betweennesses[vertexOnGeodesic] += 1;
-                    }
-                }
+template <typename T>
+void BrandesAccumulator<T>::accumulate(VertexIndex source, bool normalizeWithGeodesicNumber, vector<double>& betweennesses,
+        vector<double>* edgeBetweennesses, const vector<size_t>* edgeOffsets) {
+    for (VertexIndex vertex: visitedVertices) {
+        distances[vertex] = SIZE_T_MAX;
+        pathNumbers[vertex] = 0;
+        dependencies[vertex] = 0;
+    }
+    distances[source] = 0;
+    pathNumbers[source] = 1;
+    visitedVertices.assign(1, source);
+
+    for (size_t i=0; i<visitedVertices.size(); i++) {
+        VertexIndex vertex = visitedVertices[i];
+        currentStamp++;
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == SIZE_T_MAX) {
+                distances[neighbour] = distances[vertex]+1;
+                visitedVertices.push_back(neighbour);
             }
+            if (distances[neighbour] == distances[vertex]+1 && isFirstOccurrence(neighbour))
+                pathNumbers[neighbour] += pathNumbers[vertex];
         }
     }
-    return betweennesses;
-}
 
-template <>
-vector<double> getBetweennessCentralities(const UndirectedGraph& graph, bool normalizeWithGeodesicNumber) {
-    size_t verticesNumber = graph.getSize();
-    vector<double> betweennesses;
-    betweennesses.resize(verticesNumber, 0);
-
-    MultiplePredecessors distancesPredecessors;
-    list<list<VertexIndex> > currentGeodesics;
-    for (const VertexIndex& i: graph) {
-        distancesPredecessors = findAllPredecessorsOfVertexIdx(graph, i);
-        for (const VertexIndex& j: graph) {
-            if (i>=j) continue;
-
-            currentGeodesics = findMultiplePathsToVertexFromPredecessorsIdx(graph, i, j, distancesPredecessors);
-            if (currentGeodesics.empty()) continue; // vertices i and j are not in the same component
-
-            for (auto& geodesic: currentGeodesics) {
-                for (auto& vertexOnGeodesic: geodesic) {
-                    if (vertexOnGeodesic != i && vertexOnGeodesic != j) {
-                        if (normalizeWithGeodesicNumber)
-                            betweennesses[vertexOnGeodesic] += 1./currentGeodesics.size();
-                        else
-                            betweennesses[vertexOnGeodesic] += 1;
-                    }
-                }
+    for (auto it=visitedVertices.rbegin(); it!=visitedVertices.rend(); ++it) {
+        VertexIndex vertex = *it;
+        currentStamp++;
+
+        size_t position = edgeOffsets == nullptr ? 0 : (*edgeOffsets)[vertex];
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            if (distances[neighbour] == distances[vertex]+1 && isFirstOccurrence(neighbour)) {
+                double edgeDependency = normalizeWithGeodesicNumber ?
+                    pathNumbers[vertex]/pathNumbers[neighbour]*(1+dependencies[neighbour]) : 1+dependencies[neighbour];
+
+                dependencies[vertex] += edgeDependency;
+                if (edgeBetweennesses != nullptr)
+                    (*edgeBetweennesses)[position] += normalizeWithGeodesicNumber ? edgeDependency : pathNumbers[vertex]*edgeDependency;
             }
+            position++;
         }
+        if (vertex != source)
+            betweennesses[vertex] += normalizeWithGeodesicNumber ? dependencies[vertex] : pathNumbers[vertex]*dependencies[vertex];
     }
-    return betweennesses;
 }
 
+// Every pair of vertices is reached from both of its ends in an undirected graph
+static bool countsPairsTwice(const DirectedGraph&) { return false; }
+static bool countsPairsTwice(const UndirectedGraph&) { return true; }
+
+// Sums the dependencies from the sources. The sources are split in one contiguous
+// chunk per thread, each with its own accumulator and partial sums. The partial
+// sums are then added in chunk order, so the result only depends on threadNumber.
 template <typename T>
-vector<size_t> getDiameters(const T& graph){
+static void accumulateBetweennesses(const T& graph, const vector<VertexIndex>& sources, bool normalizeWithGeodesicNumber,
+        size_t threadNumber, vector<double>& betweennesses, vector<double>* edgeBetweennesses=nullptr,
+        const vector<size_t>* edgeOffsets=nullptr) {
     size_t verticesNumber = graph.getSize();
-    vector<size_t> diameters;
-    diameters.resize(verticesNumber);
-
-    vector<size_t> shortestPathLengths;
-    size_t largestDistance;
-    for (const VertexIndex& i: graph) {
-        shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, i);
-        largestDistance = shortestPathLengths[0];
-
-        for (const VertexIndex& j: graph)
-           if (shortestPathLengths[j] > largestDistance && shortestPathLengths[j]!=SIZE_T_MAX)
-              largestDistance = shortestPathLengths[j];
-
-        if (largestDistance == SIZE_T_MAX)
-            diameters[i] = 0;
-        else
-            diameters[i] = largestDistance;
+    for (VertexIndex source: sources)
+        if (source >= verticesNumber)
+            throw out_of_range("Vertex index (" + to_string(source) +
+                    ") greater than the graph's size("+ to_string(verticesNumber) +").");
+    if (sources.empty())
+        return;
+
+    if (threadNumber == 0)
+        threadNumber = getHardwareThreadNumber();
+    size_t chunkNumber = threadNumber < sources.size() ? threadNumber : sources.size();
+
+    vector<vector<double>> partialBetweennesses(chunkNumber), partialEdgeBetweennesses(chunkNumber);
+    parallelFor(0, chunkNumber, [&](size_t chunk) {
+        partialBetweennesses[chunk].assign(verticesNumber, 0);
+        if (edgeBetweennesses != nullptr)
+            partialEdgeBetweennesses[chunk].assign(edgeBetweennesses->size(), 0);
+
+        BrandesAccumulator<T> accumulator(graph);
+        for (size_t i=chunk*sources.size()/chunkNumber; i<(chunk+1)*sources.size()/chunkNumber; i++)
+            accumulator.accumulate(sources[i], normalizeWithGeodesicNumber, partialBetweennesses[chunk],
+                    edgeBetweennesses == nullptr ? nullptr : &partialEdgeBetweennesses[chunk], edgeOffsets);
+    }, chunkNumber);
+
+    for (size_t chunk=0; chunk<chunkNumber; chunk++) {
+        for (VertexIndex vertex=0; vertex<verticesNumber; vertex++)
+            betweennesses[vertex] += partialBetweennesses[chunk][vertex];
+        if (edgeBetweennesses != nullptr)
+            for (size_t position=0; position<edgeBetweennesses->size(); position++)
+                (*edgeBetweennesses)[position] += partialEdgeBetweennesses[chunk][position];
     }
-    return diameters;
 }
 
 template <typename T>
-static double getShortestPathAverageOfVertexIdx(const T& graph, VertexIndex vertexIdx) {
-    vector<size_t> shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, vertexIdx);
+vector<double> getBetweennessCentralities(const T& graph, bool normalizeWithGeodesicNumber, size_t threadNumber) {
+    vector<VertexIndex> sources;
+    sources.reserve(graph.getSize());
+    for (VertexIndex vertex: graph)
+        sources.push_back(vertex);
+    return getBetweennessCentralities(graph, sources, normalizeWithGeodesicNumber, threadNumber);
+}
 
-    size_t sum = 0;
-    size_t componentSize = 1;
+template <typename T>
+vector<double> getBetweennessCentralities(const T& graph, const vector<VertexIndex>& sources,
+        bool normalizeWithGeodesicNumber, size_t threadNumber) {
+    vector<double> betweennesses(graph.getSize(), 0);
+    accumulateBetweennesses(graph, sources, normalizeWithGeodesicNumber, threadNumber, betweennesses);
+
+    if (countsPairsTwice(graph))
+        for (double& betweenness: betweennesses)
+            betweenness /= 2;
+    return betweennesses;
+}
 
-    for (VertexIndex& vertex: graph)
-        if (shortestPathLengths[vertex] != 0 && shortestPathLengths[vertex] != SIZE_T_MAX) {
-            sum += shortestPathLengths[vertex];
-            componentSize++;
-        }
+template <typename T>
+vector<double> getApproximateBetweennessCentralities(const T& graph, size_t sampleSize, size_t threadNumber) {
+    size_t verticesNumber = graph.getSize();
+    if (sampleSize == 0)
+        throw invalid_argument("The sample size must be positive.");
+    if (sampleSize >= verticesNumber)
+        return getBetweennessCentralities(graph, true, threadNumber);
+
+    // Drawn before the threads start so that the sample only depends on rng
+    vector<VertexIndex> sources(sampleSize);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, verticesNumber-1);
+    for (VertexIndex& source: sources)
+        source = vertexDistribution(rng);
+
+    vector<double> betweennesses = getBetweennessCentralities(graph, sources, true, threadNumber);
+    double scale = (double) verticesNumber/sampleSize;
+    for (double& betweenness: betweennesses)
+        betweenness *= scale;
+    return betweennesses;
+}
 
-    return componentSize > 1 ? (double) sum / componentSize : 0;
+// The dependency of a vertex on a source is at most n-2. Hoeffding's inequality with
+// a union bound over the n vertices gives the number of samples.
+size_t getBetweennessSampleSize(size_t verticesNumber, double epsilon, double delta) {
+    if (epsilon <= 0 || epsilon >= 1)
+        throw invalid_argument("Epsilon must be in the interval (0, 1).");
+    if (delta <= 0 || delta >= 1)
+        throw invalid_argument("Delta must be in the interval (0, 1).");
+    if (verticesNumber == 0)
+        return 0;
+    return ceil(log(2*verticesNumber/delta) / (2*epsilon*epsilon));
 }
 
 template <typename T>
-vector<double> getShortestPathAverages(const T& graph) {
-    vector<double> averageShortestPaths(graph.getSize(), 0);
+map<Edge, double> getEdgeBetweennessCentralities(const T& graph, bool normalizeWithGeodesicNumber, size_t threadNumber) {
+    size_t verticesNumber = graph.getSize();
+    vector<size_t> edgeOffsets(verticesNumber+1, 0);
+    vector<VertexIndex> sources;
+    for (VertexIndex vertex: graph) {
+        edgeOffsets[vertex+1] = edgeOffsets[vertex] + graph.getOutEdgesOfIdx(vertex).size();
+        sources.push_back(vertex);
+    }
 
-    for (VertexIndex vertex: graph)
-        averageShortestPaths[vertex] = getShortestPathAverageOfVertexIdx(graph, vertex);
+    vector<double> betweennesses(verticesNumber, 0);
+    vector<double> positionBetweennesses(edgeOffsets[verticesNumber], 0);
+    accumulateBetweennesses(graph, sources, normalizeWithGeodesicNumber, threadNumber,
+            betweennesses, &positionBetweennesses, &edgeOffsets);
+
+    bool undirected = countsPairsTwice(graph);
+    map<Edge, double> edgeBetweennesses;
+    for (VertexIndex vertex: graph) {
+        size_t position = edgeOffsets[vertex];
+        for (const VertexIndex& neighbour: graph.getOutEdgesOfIdx(vertex)) {
+            Edge edge = undirected && neighbour < vertex ? Edge(neighbour, vertex) : Edge(vertex, neighbour);
+            edgeBetweennesses[edge] += undirected ? positionBetweennesses[position]/2 : positionBetweennesses[position];
+            position++;
+        }
+    }
+    return edgeBetweennesses;
+}
 
-    return averageShortestPaths;
+static vector<size_t> findEccentricities(const DirectedGraph& graph) {
+    return getShortestPathMetrics(graph, ECCENTRICITIES, getThreadNumber()).eccentricities;
+}
+
+// The eccentricity bounds need symmetric distances
+static vector<size_t> findEccentricities(const UndirectedGraph& graph) {
+    return getEccentricities(graph);
 }
 
 template <typename T>
-vector<unordered_map<size_t, double> > getShortestPathsDistribution(const T& graph) {
-    auto connectedComponents = findConnectedComponents(graph);
-
-    vector<size_t> shortestPathLengths;
-    vector<unordered_map<size_t, double> > shortestPathDistribution(connectedComponents.size());
-    size_t componentIndex = 0;
-
-    for (auto component: connectedComponents) {
-        auto& currentDistribution = shortestPathDistribution[componentIndex];
-
-        if (component.size() > 1) {
-            for (const VertexIndex& vertex: component) {
-                shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, vertex);
-
-                for (const size_t& pathLength: shortestPathLengths) {
-                    if (pathLength!=0 && pathLength!=SIZE_T_MAX) {
-                        if (currentDistribution.find(pathLength) == currentDistribution.end())
-                            currentDistribution[pathLength] = 1;
-                        else
-                            currentDistribution[pathLength]++;
-                    }
-                }
-            }
-            for (auto& element: currentDistribution)
-                element.second /= component.size();
-        }
+vector<size_t> getDiameters(const T& graph){
+    return findEccentricities(graph);
+}
 
-        componentIndex++;
-    }
-    return shortestPathDistribution;
+template <typename T>
+vector<double> getShortestPathAverages(const T& graph) {
+    return getShortestPathMetrics(graph, SHORTEST_PATH_AVERAGES, getThreadNumber()).shortestPathAverages;
 }
 
 template <typename T>
-static double getShortestPathHarmonicAverageOfVertexIdx(const T& graph, VertexIndex vertexIdx){
-    vector<size_t> shortestPathLengths = findShortestPathLengthsFromVertexIdx(graph, vertexIdx);
-    size_t componentSize = 0;
-
-    double sumOfInverse = 0;
-    for (VertexIndex& vertex: graph) {
-        if (shortestPathLengths[vertex] != 0 && shortestPathLengths[vertex] != SIZE_T_MAX){
-            componentSize += 1;
-            sumOfInverse += 1.0/shortestPathLengths[vertex];
-        }
-    }
-    return componentSize > 0 ? sumOfInverse/componentSize : 0;
+vector<unordered_map<size_t, double> > getShortestPathsDistribution(const T& graph) {
+    return getShortestPathMetrics(graph, SHORTEST_PATHS_DISTRIBUTION, getThreadNumber()).shortestPathsDistribution;
 }
 
 template <typename T>
 vector<double> getShortestPathHarmonicAverages(const T& graph) {
-    vector<double> harmonicAverages(graph.getSize(), 0);
-
-    for (VertexIndex vertex: graph)
-        harmonicAverages[vertex] = getShortestPathHarmonicAverageOfVertexIdx(graph, vertex);
-
-    return harmonicAverages;
+    return getShortestPathMetrics(graph, SHORTEST_PATH_HARMONIC_AVERAGES, getThreadNumber()).shortestPathHarmonicAverages;
 }
 
 template <typename T>
@@ -233,55 +410,53 @@ list<Component> findConnectedComponents(const T& graph){
     if (verticesNumber == 0) throw logic_error("There are no vertices.");
 
     list<Component> connectedComponents;
-    Component currentComponent;
-    VertexIndex currentVertex, startVertex;
-
     queue<VertexIndex> verticesToProcess;
-    vector<bool> processedVertices;
-    bool allVerticesProcessed = false;
-    processedVertices.resize(verticesNumber, false);
-
-    list<VertexIndex>::const_iterator vertexNeighbour;
-
-    while (!allVerticesProcessed){
-        allVerticesProcessed = true;
-        for (VertexIndex i=0; i<verticesNumber && allVerticesProcessed; ++i){
-            if (!processedVertices[i]) {
-                allVerticesProcessed = false;
-                startVertex = i;
-            }
-        }
+    vector<bool> processedVertices(verticesNumber, false);
 
-        if (!allVerticesProcessed){
-            currentComponent.clear();
-            verticesToProcess.push(startVertex);
-            processedVertices[startVertex] = true;
+    // Every vertex before startVertex is processed, so the scan never restarts
+    for (VertexIndex startVertex=0; startVertex<verticesNumber; startVertex++) {
+        if (processedVertices[startVertex])
+            continue;
 
-            while (!verticesToProcess.empty()) {
-                currentVertex = verticesToProcess.front();
+        Component currentComponent;
+        verticesToProcess.push(startVertex);
+        processedVertices[startVertex] = true;
 
-                for (const VertexIndex& vertexNeighbour: graph.getOutEdgesOfIdx(currentVertex)) {
-                    if (!processedVertices[vertexNeighbour]) {
-                        verticesToProcess.push(vertexNeighbour);
-                        processedVertices[vertexNeighbour] = true;
-                    }
+        while (!verticesToProcess.empty()) {
+            VertexIndex currentVertex = verticesToProcess.front();
+
+            for (const VertexIndex& vertexNeighbour: graph.getOutEdgesOfIdx(currentVertex)) {
+                if (!processedVertices[vertexNeighbour]) {
+                    verticesToProcess.push(vertexNeighbour);
+                    processedVertices[vertexNeighbour] = true;
                 }
-                currentComponent.push_back(currentVertex);
-                verticesToProcess.pop();
             }
-            connectedComponents.push_back(currentComponent);
+            currentComponent.push_back(currentVertex);
+            verticesToProcess.pop();
         }
+        connectedComponents.push_back(move(currentComponent));
     }
     return connectedComponents;
 }
 
 // Allowed classes for metrics
 
+template ShortestPathMetrics getShortestPathMetrics(const DirectedGraph& graph, unsigned int metrics, size_t threadNumber);
+template ShortestPathMetrics getShortestPathMetrics(const UndirectedGraph& graph, unsigned int metrics, size_t threadNumber);
 template vector<double> getClosenessCentralities(const DirectedGraph& graph);
 template vector<double> getClosenessCentralities(const UndirectedGraph& graph);
 template vector<double> getHarmonicCentralities(const DirectedGraph& graph);
 template vector<double> getHarmonicCentralities(const UndirectedGraph& graph);
 
+template vector<double> getBetweennessCentralities(const DirectedGraph& graph, bool normalizeWithGeodesicNumber, size_t threadNumber);
+template vector<double> getBetweennessCentralities(const UndirectedGraph& graph, bool normalizeWithGeodesicNumber, size_t threadNumber);
+template vector<double> getBetweennessCentralities(const DirectedGraph& graph, const vector<VertexIndex>& sources, bool normalizeWithGeodesicNumber, size_t threadNumber);
+template vector<double> getBetweennessCentralities(const UndirectedGraph& graph, const vector<VertexIndex>& sources, bool normalizeWithGeodesicNumber, size_t threadNumber);
+template vector<double> getApproximateBetweennessCentralities(const DirectedGraph& graph, size_t sampleSize, size_t threadNumber);
+template vector<double> getApproximateBetweennessCentralities(const UndirectedGraph& graph, size_t sampleSize, size_t threadNumber);
+template map<Edge, double> getEdgeBetweennessCentralities(const DirectedGraph& graph, bool normalizeWithGeodesicNumber, size_t threadNumber);
+template map<Edge, double> getEdgeBetweennessCentralities(const UndirectedGraph& graph, bool normalizeWithGeodesicNumber, size_t threadNumber);
+
 template vector<size_t> getDiameters(const DirectedGraph& graph);
 template vector<size_t> getDiameters(const UndirectedGraph& graph);
 template vector<double> getShortestPathAverages(const DirectedGraph& graph);
@@ -1,12 +1,14 @@
 #include <vector>
 #include <list>
 #include <set>
-#include <unordered_set>
 #include <unordered_map>
 #include <utility>
 #include <algorithm>
 
 #include "BaseGraph/metrics/undirected.h"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
+#include "BaseGraph/algorithms/triangles.h"
+#include "BaseGraph/parallel.hpp"
 
 
 using namespace std;
@@ -14,45 +16,34 @@ using namespace std;
 
 namespace BaseGraph{
 
-template<typename T>
-static std::list<T> intersectionOf(const std::list<T>& a, const std::list<T>& b);
 template <typename T>
 static double getAverage(const T& iterable);
 
 
 size_t countTrianglesAroundVertexIdx(const UndirectedGraph& graph, VertexIndex vertex1){
-    size_t triangleNumber = 0;
-    auto vertexNeighbourhood = graph.getNeighboursOfIdx(vertex1);
-
-    for(VertexIndex& vertex2: vertexNeighbourhood)
-        triangleNumber += intersectionOf(vertexNeighbourhood, graph.getNeighboursOfIdx(vertex2)).size();
+    const list<VertexIndex>& neighbours = graph.getNeighboursOfIdx(vertex1);
+    vector<VertexIndex> sortedNeighbours;
+    sortedNeighbours.reserve(neighbours.size());
+    for (const VertexIndex& vertex2: neighbours)
+        if (vertex2 != vertex1)
+            sortedNeighbours.push_back(vertex2);
+    sort(sortedNeighbours.begin(), sortedNeighbours.end());
+    sortedNeighbours.erase(unique(sortedNeighbours.begin(), sortedNeighbours.end()), sortedNeighbours.end());
 
-    return triangleNumber/2;  // Triangles are all counted twice
+    size_t triangleNumber = 0;
+    for (const VertexIndex& vertex2: sortedNeighbours)
+        for (const VertexIndex& vertex3: graph.getNeighboursOfIdx(vertex2))
+            if (vertex2 < vertex3 && binary_search(sortedNeighbours.begin(), sortedNeighbours.end(), vertex3))
+                triangleNumber++;
+    return triangleNumber;
 }
 
 list<array<VertexIndex, 3>> findAllTriangles(const UndirectedGraph& graph){
-    list<array<VertexIndex, 3>> triangles;
-
-    for(VertexIndex& vertex1: graph) {
-        const list<VertexIndex>& vertex1Neighbours = graph.getNeighboursOfIdx(vertex1);
-
-        for (const VertexIndex& vertex2: vertex1Neighbours) {
-
-            if (vertex1 < vertex2)
-                for (const VertexIndex& vertex3: intersectionOf(vertex1Neighbours, graph.getNeighboursOfIdx(vertex2)))
-                    if (vertex2 < vertex3)
-                        triangles.push_back({vertex1, vertex2, vertex3});
-        }
-    }
-    return triangles;
+    return TriangleEnumerator(graph).findAllTriangles();
 }
 
 size_t countTriangles(const UndirectedGraph& graph){
-    size_t triangleTotal = 0;
-    for(VertexIndex& vertex: graph)
-        triangleTotal += countTrianglesAroundVertexIdx(graph, vertex);
-
-    return triangleTotal/3;
+    return TriangleEnumerator(graph).countTriangles(getThreadNumber()).triangleNumber;
 }
 
 vector<double> getDegreeDistribution(const UndirectedGraph &graph) {
@@ -65,12 +56,7 @@ vector<double> getDegreeDistribution(const UndirectedGraph &graph) {
 }
 
 double getGlobalClusteringCoefficient(const UndirectedGraph& graph) {
-    vector<size_t> vertexTriangleNumbers;
-    vertexTriangleNumbers.resize(graph.getSize());
-
-    for (VertexIndex& vertex: graph)
-        vertexTriangleNumbers[vertex] = countTrianglesAroundVertexIdx(graph, vertex);
-    return getGlobalClusteringCoefficient(graph, vertexTriangleNumbers);
+    return getGlobalClusteringCoefficient(graph, TriangleEnumerator(graph).countTriangles(getThreadNumber()).vertexTriangleNumbers);
 }
 
 double getGlobalClusteringCoefficient(const UndirectedGraph& graph, const vector<size_t>& vertexTriangleNumbers) {
@@ -99,13 +85,11 @@ vector<double> getRedundancy(const UndirectedGraph& graph) {
 vector<double> getLocalClusteringCoefficients(const UndirectedGraph& graph) {
     vector<double> localClusteringCoefficients;
     localClusteringCoefficients.resize(graph.getSize(), 0);
+    vector<size_t> vertexTriangleNumbers = TriangleEnumerator(graph).countTriangles(getThreadNumber()).vertexTriangleNumbers;
 
-    int vertexDegree;
-    double triangleNumber;
-
-    for(VertexIndex& vertex: graph) {
-        vertexDegree = graph.getDegreeIdx(vertex);
-        triangleNumber = countTrianglesAroundVertexIdx(graph, vertex);
+    for (VertexIndex& vertex: graph) {
+        int vertexDegree = graph.getDegreeIdx(vertex);
+        double triangleNumber = vertexTriangleNumbers[vertex];
 
         if(vertexDegree > 1)
           localClusteringCoefficients[vertex] = 2.0*triangleNumber / vertexDegree / (vertexDegree - 1);
@@ -231,8 +215,9 @@ list<size_t> getNeighbourhoodDegreesOfVertexIdx(const UndirectedGraph& graph, Ve
 vector<double> getNeighbourDegreeSpectrum(const UndirectedGraph &graph, bool normalized) {
     vector<double> degreeSpectrum(graph.getSize());
 
-    for (VertexIndex& vertex: graph)
+    parallelForDynamic(0, graph.getSize(), [&](VertexIndex vertex) {
         degreeSpectrum[vertex] = getAverage(getNeighbourhoodDegreesOfVertexIdx(graph, vertex));
+    }, getThreadNumber());
 
     if (normalized) {
         double firstMoment = 0;
@@ -334,6 +319,66 @@ double getDegreeCorrelation(const UndirectedGraph& graph, double averageDegree)
     return degreeCorrelationCoefficient/excessDegreeVariance;
 }
 
+// Returns the diameter. With diameterOnly, the vertices that cannot have the largest
+// eccentricity are dropped and their bounds are not tight.
+static size_t boundEccentricities(const UndirectedGraph& graph, bool diameterOnly,
+        vector<size_t>& lowerBounds, vector<size_t>& upperBounds) {
+    size_t verticesNumber = graph.getSize();
+    vector<size_t> degrees = graph.getDegrees();
+    lowerBounds.assign(verticesNumber, 0);
+    upperBounds.assign(verticesNumber, SIZE_T_MAX);
+
+    vector<VertexIndex> candidates;
+    for (VertexIndex vertex: graph) {
+        if (degrees[vertex] == 0)
+            upperBounds[vertex] = 0;
+        else
+            candidates.push_back(vertex);
+    }
+
+    BreadthFirstSearch<UndirectedGraph> search(graph);
+    size_t diameter = 0;
+    bool selectLargestUpperBound = true;
+    while (!candidates.empty()) {
+        // Ties go to the vertex of highest degree, whose search tightens the most bounds
+        VertexIndex source = candidates[0];
+        for (VertexIndex vertex: candidates) {
+            size_t bound = selectLargestUpperBound ? upperBounds[vertex] : lowerBounds[vertex];
+            size_t sourceBound = selectLargestUpperBound ? upperBounds[source] : lowerBounds[source];
+            if ((selectLargestUpperBound ? bound > sourceBound : bound < sourceBound)
+                    || (bound == sourceBound && degrees[vertex] > degrees[source]))
+                source = vertex;
+        }
+        selectLargestUpperBound = !selectLargestUpperBound;
+
+        search.run(source);
+        const vector<size_t>& distances = search.getDistances();
+        size_t eccentricity = distances[search.getVisitedVertices().back()];
+        for (VertexIndex vertex: search.getVisitedVertices()) {
+            size_t distance = distances[vertex];
+            lowerBounds[vertex] = max(lowerBounds[vertex], max(eccentricity-distance, distance));
+            upperBounds[vertex] = min(upperBounds[vertex], eccentricity+distance);
+            diameter = max(diameter, lowerBounds[vertex]);
+        }
+
+        candidates.erase(remove_if(candidates.begin(), candidates.end(), [&](VertexIndex vertex) {
+            return lowerBounds[vertex] == upperBounds[vertex] || (diameterOnly && upperBounds[vertex] <= diameter);
+        }), candidates.end());
+    }
+    return diameter;
+}
+
+vector<size_t> getEccentricities(const UndirectedGraph& graph) {
+    vector<size_t> eccentricities, upperBounds;
+    boundEccentricities(graph, false, eccentricities, upperBounds);
+    return eccentricities;
+}
+
+size_t getDiameter(const UndirectedGraph& graph) {
+    vector<size_t> lowerBounds, upperBounds;
+    return boundEccentricities(graph, true, lowerBounds, upperBounds);
+}
+
 double getModularity(const UndirectedGraph& graph, const vector<size_t>& vertexCommunities) {
     if (graph.getSize() == 0) throw std::logic_error("Graph is empty");
     if (vertexCommunities.size() != graph.getSize()) throw std::logic_error("Vertex communities vector must be the size of the graph");
@@ -360,24 +405,6 @@ double getModularity(const UndirectedGraph& graph, const vector<size_t>& vertexC
     return modularity;
 }
 
-// From https://stackoverflow.com/questions/38993415/how-to-apply-the-intersection-between-two-lists-in-c
-template<typename T>
-static std::list<T> intersectionOf(const std::list<T>& a, const std::list<T>& b){
-    std::list<T> rtn;
-    std::unordered_multiset<T> st;
-    std::for_each(a.begin(), a.end(), [&st](const T& k){ st.insert(k); });
-    std::for_each(b.begin(), b.end(),
-        [&st, &rtn](const T& k){
-            auto iter = st.find(k);
-            if(iter != st.end()){
-                rtn.push_back(k);
-                st.erase(iter);
-            }
-        }
-    );
-    return rtn;
-}
-
 template <typename T>
 static double getAverage(const T& iterable) {
     if (iterable.size() == 0)
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "BaseGraph/perfecthash.h"
+#include "BaseGraph/binarystream.hpp"
+
+
+using namespace std;
+
+
+namespace BaseGraph{
+
+static const char PERFECT_HASH_FILE_TAG[] = "BaseGraphPHF2";
+static const size_t AVERAGE_BUCKET_SIZE = 4;
+
+
+// Keys whose hash is already taken by a smaller key are set aside in the collisions,
+// so that the perfect hash is built over distinct hash values.
+void PerfectHashIndex::build(const vector<size_t>& allKeyHashes) {
+    clear();
+    if (allKeyHashes.empty())
+        return;
+
+    vector<pair<size_t, VertexIndex>> sortedKeys;
+    sortedKeys.reserve(allKeyHashes.size());
+    for (VertexIndex key=0; key<allKeyHashes.size(); key++)
+        sortedKeys.push_back({allKeyHashes[key], key});
+    sort(sortedKeys.begin(), sortedKeys.end());
+
+    vector<size_t> keyHashes;
+    vector<VertexIndex> keyValues;
+    for (size_t i=0; i<sortedKeys.size(); i++) {
+        if (i > 0 && sortedKeys[i].first == sortedKeys[i-1].first)
+            collisions.push_back(sortedKeys[i]);
+        else {
+            keyHashes.push_back(sortedKeys[i].first);
+            keyValues.push_back(sortedKeys[i].second);
+        }
+    }
+    size_t keyNumber = keyHashes.size();
+
+    displacements.resize((keyNumber+AVERAGE_BUCKET_SIZE-1)/AVERAGE_BUCKET_SIZE, 0);
+    values.resize(keyNumber, SIZE_T_MAX);
+    size_t bucketNumber = displacements.size();
+
+    // Counting sort of the keys by bucket
+    vector<size_t> bucketOffsets(bucketNumber+1, 0);
+    for (size_t keyHash: keyHashes)
+        bucketOffsets[getBucket(keyHash)+1]++;
+    size_t largestBucket = 0;
+    for (size_t bucket=0; bucket<bucketNumber; bucket++) {
+        largestBucket = max(largestBucket, bucketOffsets[bucket+1]);
+        bucketOffsets[bucket+1] += bucketOffsets[bucket];
+    }
+    vector<size_t> keysOfBuckets(keyNumber);
+    vector<size_t> insertPositions(bucketOffsets.begin(), bucketOffsets.end()-1);
+    for (size_t key=0; key<keyNumber; key++)
+        keysOfBuckets[insertPositions[getBucket(keyHashes[key])]++] = key;
+
+    // Largest buckets are placed first, while most positions are free
+    vector<vector<size_t>> bucketsOfSize(largestBucket+1);
+    for (size_t bucket=0; bucket<bucketNumber; bucket++)
+        bucketsOfSize[bucketOffsets[bucket+1]-bucketOffsets[bucket]].push_back(bucket);
+
+    vector<bool> takenPositions(keyNumber, false);
+    vector<size_t> positions(largestBucket);
+
+    for (size_t bucketSize=largestBucket; bucketSize>0; bucketSize--) {
+        for (size_t bucket: bucketsOfSize[bucketSize]) {
+            const size_t* keys = &keysOfBuckets[bucketOffsets[bucket]];
+
+            uint64_t displacement = 0;
+            bool placed = false;
+            while (!placed) {
+                if (displacement > numeric_limits<uint32_t>::max())
+                    throw runtime_error("Cannot build perfect hash: no displacement found for a bucket.");
+
+                placed = true;
+                for (size_t i=0; i<bucketSize && placed; i++) {
+                    positions[i] = getPosition(keyHashes[keys[i]], displacement);
+                    if (takenPositions[positions[i]])
+                        placed = false;
+                    for (size_t j=0; j<i && placed; j++)
+                        if (positions[j] == positions[i])
+                            placed = false;
+                }
+                if (!placed)
+                    displacement++;
+            }
+
+            displacements[bucket] = displacement;
+            for (size_t i=0; i<bucketSize; i++) {
+                takenPositions[positions[i]] = true;
+                values[positions[i]] = keyValues[keys[i]];
+            }
+        }
+    }
+}
+
+void PerfectHashIndex::writeInBinaryStream(ostream& stream) const {
+    uint64_t distinctKeyNumber = values.size(), bucketNumber = displacements.size(), collisionNumber = collisions.size();
+
+    stream.write(PERFECT_HASH_FILE_TAG, sizeof(PERFECT_HASH_FILE_TAG));
+    stream.write((char*) &distinctKeyNumber, sizeof(distinctKeyNumber));
+    stream.write((char*) &bucketNumber, sizeof(bucketNumber));
+    stream.write((char*) &collisionNumber, sizeof(collisionNumber));
+    stream.write((char*) displacements.data(), bucketNumber*sizeof(uint32_t));
+    for (VertexIndex value: values) {
+        uint64_t fixedSizeValue = value;
+        stream.write((char*) &fixedSizeValue, sizeof(fixedSizeValue));
+    }
+    for (auto& collision: collisions) {
+        uint64_t fixedSizeCollision[2] = {collision.first, collision.second};
+        stream.write((char*) fixedSizeCollision, sizeof(fixedSizeCollision));
+    }
+}
+
+void PerfectHashIndex::loadFromBinaryStream(istream& stream, size_t expectedKeyNumber) {
+    char tag[sizeof(PERFECT_HASH_FILE_TAG)];
+    uint64_t distinctKeyNumber, bucketNumber, collisionNumber;
+
+    clear();
+    stream.read(tag, sizeof(tag));
+    if (!stream || string(tag, sizeof(tag)-1) != PERFECT_HASH_FILE_TAG)
+        throw runtime_error("Stream does not contain a perfect hash index.");
+    stream.read((char*) &distinctKeyNumber, sizeof(distinctKeyNumber));
+    stream.read((char*) &bucketNumber, sizeof(bucketNumber));
+    stream.read((char*) &collisionNumber, sizeof(collisionNumber));
+
+    // The counts are validated before any allocation
+    const uint64_t MAX_COUNT = numeric_limits<uint64_t>::max()/64;
+    if (!stream || distinctKeyNumber > MAX_COUNT || collisionNumber > MAX_COUNT || bucketNumber > distinctKeyNumber
+            || (distinctKeyNumber > 0 && bucketNumber == 0) || (distinctKeyNumber == 0 && collisionNumber > 0))
+        throw runtime_error("Corrupted perfect hash index.");
+    uint64_t keyNumber = distinctKeyNumber+collisionNumber;
+    if (expectedKeyNumber != SIZE_T_MAX && keyNumber != expectedKeyNumber)
+        throw runtime_error("The perfect hash index does not have the expected number of keys.");
+    if (bucketNumber*sizeof(uint32_t) + distinctKeyNumber*sizeof(uint64_t) + collisionNumber*2*sizeof(uint64_t) > getRemainingStreamSize(stream))
+        throw runtime_error("Corrupted perfect hash index: the stream is too short.");
+
+    displacements.resize(bucketNumber);
+    values.resize(distinctKeyNumber);
+    collisions.resize(collisionNumber);
+    stream.read((char*) displacements.data(), bucketNumber*sizeof(uint32_t));
+    for (VertexIndex& value: values) {
+        uint64_t fixedSizeValue;
+        stream.read((char*) &fixedSizeValue, sizeof(fixedSizeValue));
+        value = fixedSizeValue;
+    }
+    for (auto& collision: collisions) {
+        uint64_t fixedSizeCollision[2];
+        stream.read((char*) fixedSizeCollision, sizeof(fixedSizeCollision));
+        collision = {fixedSizeCollision[0], fixedSizeCollision[1]};
+    }
+
+    bool valid = bool(stream) && is_sorted(collisions.begin(), collisions.end());
+    for (size_t i=0; i<values.size() && valid; i++)
+        valid = values[i] < keyNumber;
+    for (size_t i=0; i<collisions.size() && valid; i++)
+        valid = collisions[i].second < keyNumber;
+    if (!valid) {
+        clear();
+        throw runtime_error("Corrupted perfect hash index.");
+    }
+}
+
+} // namespace BaseGraph
@@ -39,6 +39,20 @@ namespace std {
 }; // namespace std
 
 
+struct CustomOrderableType: public CustomNonHashableType {
+    CustomOrderableType(const std::string& label): CustomNonHashableType(label) {}
+
+    bool operator<(const CustomOrderableType& other) const { return label < other.label; }
+};
+
+
+struct CustomLabelHash {
+    size_t operator()(const CustomNonHashableType& object) const {
+        return std::hash<std::string>()(object.label);
+    }
+};
+
+
 template<typename T>
 std::vector<T> getLabels() {
     std::string error = "Test fixture: getLabels() not implemented for type" + std::string(typeid(T).name());
@@ -66,6 +80,11 @@ inline std::vector<CustomNonHashableType> getLabels() {
     using T = CustomNonHashableType;
     return {T("A"), T("B"), T("C"), T("D"), T("E")};
 };
+template<>
+inline std::vector<CustomOrderableType> getLabels() {
+    using T = CustomOrderableType;
+    return {T("A"), T("B"), T("C"), T("D"), T("E")};
+};
 
 
 template<typename T>
@@ -95,6 +114,11 @@ inline std::vector<CustomNonHashableType> getOtherLabels() {
     using T = CustomNonHashableType;
     return {T("Z"), T("Y"), T("X"), T("W"), T("V")};
 };
+template<>
+inline std::vector<CustomOrderableType> getOtherLabels() {
+    using T = CustomOrderableType;
+    return {T("Z"), T("Y"), T("X"), T("W"), T("V")};
+};
 
 
 template<typename Graph_Label_hashable>
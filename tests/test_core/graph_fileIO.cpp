@@ -1,5 +1,6 @@
 #include <stdexcept>
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <sstream>
 
@@ -368,3 +369,60 @@ TEST_F(SmallGraph2, when_loadingGraphFromEdgelist_expect_graphIgnoresMultiedgesA
 
     remove("testGraph_tmp.txt");
 }
+
+
+TEST(FrozenLabelIndex, when_writingAndLoadingIndex_expect_sameVertexIndices){
+    BaseGraph::VertexLabeledUndirectedGraph<std::string, true> graph, loadedGraph;
+    for (size_t i=0; i<100; i++) {
+        graph.addVertex(to_string(i));
+        loadedGraph.addVertex(to_string(i));
+    }
+    graph.freeze();
+    BaseGraph::writeFrozenLabelIndexInBinaryFile(graph, "testIndex_tmp.bin");
+    BaseGraph::loadFrozenLabelIndexFromBinaryFile(loadedGraph, "testIndex_tmp.bin");
+
+    EXPECT_TRUE(loadedGraph.isFrozen());
+    for (size_t i=0; i<100; i++)
+        EXPECT_EQ(loadedGraph.findVertexIndex(to_string(i)), i);
+
+    remove("testIndex_tmp.bin");
+}
+
+TEST(FrozenLabelIndex, when_loadingTruncatedIndexOrIndexOfOtherSize_expect_throwRuntimeError){
+    BaseGraph::VertexLabeledUndirectedGraph<std::string, true> graph, smallerGraph, loadedGraph;
+    for (size_t i=0; i<100; i++) {
+        graph.addVertex(to_string(i));
+        loadedGraph.addVertex(to_string(i));
+        if (i < 50)
+            smallerGraph.addVertex(to_string(i));
+    }
+    graph.freeze();
+    BaseGraph::writeFrozenLabelIndexInBinaryFile(graph, "testIndex_tmp.bin");
+    EXPECT_THROW(BaseGraph::loadFrozenLabelIndexFromBinaryFile(smallerGraph, "testIndex_tmp.bin"), std::runtime_error);
+
+    std::ifstream file("testIndex_tmp.bin", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::ofstream truncatedFile("testIndex_tmp.bin", std::ios::binary);
+    truncatedFile.write(content.data(), content.size()/2);
+    truncatedFile.close();
+
+    EXPECT_THROW(BaseGraph::loadFrozenLabelIndexFromBinaryFile(loadedGraph, "testIndex_tmp.bin"), std::runtime_error);
+    EXPECT_FALSE(loadedGraph.isFrozen());
+    remove("testIndex_tmp.bin");
+}
+
+TEST(FrozenLabelIndex, when_loadingIndexOfOtherLabels_expect_throwInvalidArgument){
+    BaseGraph::VertexLabeledUndirectedGraph<std::string, true> graph, otherGraph;
+    for (size_t i=0; i<100; i++) {
+        graph.addVertex(to_string(i));
+        otherGraph.addVertex(to_string(99-i));
+    }
+    graph.freeze();
+    BaseGraph::writeFrozenLabelIndexInBinaryFile(graph, "testIndex_tmp.bin");
+
+    EXPECT_THROW(BaseGraph::loadFrozenLabelIndexFromBinaryFile(otherGraph, "testIndex_tmp.bin"), std::invalid_argument);
+    EXPECT_FALSE(otherGraph.isFrozen());
+
+    remove("testIndex_tmp.bin");
+}
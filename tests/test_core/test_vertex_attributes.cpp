@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "BaseGraph/undirectedgraph.h"
+#include "BaseGraph/vertex_attributes.hpp"
+
+
+using namespace std;
+
+
+class VertexAttributesOfGraph: public::testing::Test{
+    public:
+        BaseGraph::UndirectedGraph graph = BaseGraph::UndirectedGraph(4);
+        BaseGraph::VertexAttributes attributes = BaseGraph::VertexAttributes(graph);
+
+        void SetUp(){
+            attributes.addAttribute<uint8_t>("infected");
+            attributes.addAttribute<double>("weight", 1.5);
+        }
+};
+
+
+TEST_F(VertexAttributesOfGraph, when_addingAttribute_expect_oneDefaultValuePerVertex){
+    EXPECT_EQ(attributes.getAttribute<uint8_t>("infected"), vector<uint8_t>(4, 0));
+    EXPECT_EQ(attributes.getAttribute<double>("weight"), vector<double>(4, 1.5));
+    EXPECT_EQ(attributes.getAttributeNames(), vector<string>({"infected", "weight"}));
+}
+
+TEST_F(VertexAttributesOfGraph, when_accessingInexistentAttributeOrWrongType_expect_throwInvalidArgument){
+    EXPECT_THROW(attributes.getAttribute<uint8_t>("age"), invalid_argument);
+    EXPECT_THROW(attributes.getAttribute<int>("infected"), invalid_argument);
+    EXPECT_THROW(attributes.addAttribute<int>("infected"), invalid_argument);
+}
+
+TEST_F(VertexAttributesOfGraph, when_settingValuesInBulk_expect_onlySelectedVerticesChanged){
+    vector<BaseGraph::VertexIndex> vertices = {1, 3};
+    attributes.setValues<uint8_t>("infected", vertices.begin(), vertices.end(), 1);
+    EXPECT_EQ(attributes.getAttribute<uint8_t>("infected"), vector<uint8_t>({0, 1, 0, 1}));
+
+    vertices.push_back(4);
+    EXPECT_THROW(attributes.setValues<uint8_t>("infected", vertices.begin(), vertices.end(), 2), out_of_range);
+    EXPECT_EQ(attributes.getAttribute<uint8_t>("infected"), vector<uint8_t>({0, 1, 0, 1}));
+
+    attributes.fill<double>("weight", 2);
+    EXPECT_EQ(attributes.getAttribute<double>("weight"), vector<double>(4, 2));
+    EXPECT_THROW(attributes.assign<double>("weight", {1, 2}), invalid_argument);
+}
+
+TEST(VertexAttributes, when_constructingFromIntegerVertexNumber_expect_emptyColumnsOfThatSize){
+    BaseGraph::VertexAttributes attributes(5);
+    EXPECT_EQ(attributes.addAttribute<int>("age"), vector<int>(5, 0));
+}
+
+TEST_F(VertexAttributesOfGraph, when_graphGrows_expect_newVerticesHaveDefaultValue){
+    attributes.fill<double>("weight", 3);
+    graph.resize(6);
+    attributes.resizeToGraph(graph);
+
+    EXPECT_EQ(attributes.getVertexNumber(), 6);
+    EXPECT_EQ(attributes.getAttribute<double>("weight"), vector<double>({3, 3, 3, 3, 1.5, 1.5}));
+}
+
+TEST_F(VertexAttributesOfGraph, when_writingAndLoadingAttributes_expect_sameValues){
+    attributes.assign<double>("weight", {1, 2, 3, 4});
+    attributes.getAttribute<uint8_t>("infected")[2] = 1;
+    attributes.writeInBinaryFile("testAttributes_tmp.bin");
+
+    BaseGraph::VertexAttributes loadedAttributes(graph);
+    loadedAttributes.addAttribute<uint8_t>("infected");
+    loadedAttributes.addAttribute<double>("weight");
+    loadedAttributes.loadFromBinaryFile("testAttributes_tmp.bin");
+
+    EXPECT_EQ(loadedAttributes.getAttribute<double>("weight"), vector<double>({1, 2, 3, 4}));
+    EXPECT_EQ(loadedAttributes.getAttribute<uint8_t>("infected"), vector<uint8_t>({0, 0, 1, 0}));
+
+    BaseGraph::VertexAttributes otherTypeAttributes(graph);
+    otherTypeAttributes.addAttribute<uint8_t>("infected");
+    otherTypeAttributes.addAttribute<float>("weight");
+    EXPECT_THROW(otherTypeAttributes.loadFromBinaryFile("testAttributes_tmp.bin"), runtime_error);
+
+    BaseGraph::VertexAttributes sameSizeAttributes(graph);
+    sameSizeAttributes.addAttribute<uint8_t>("infected");
+    sameSizeAttributes.addAttribute<int64_t>("weight");
+    EXPECT_THROW(sameSizeAttributes.loadFromBinaryFile("testAttributes_tmp.bin"), runtime_error);
+
+    remove("testAttributes_tmp.bin");
+}
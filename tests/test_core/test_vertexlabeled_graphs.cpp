@@ -1,3 +1,4 @@
+#include <list>
 #include <stdexcept>
 #include <vector>
 #include <type_traits>
@@ -17,6 +18,7 @@ using TestTypes = ::testing::Types<
                         std::tuple<BaseGraph::DirectedGraph, CustomHashableType,    std::true_type>,
                         std::tuple<BaseGraph::DirectedGraph, CustomHashableType,    std::false_type>,
                         std::tuple<BaseGraph::DirectedGraph, CustomNonHashableType, std::false_type>,
+                        std::tuple<BaseGraph::DirectedGraph, CustomOrderableType,   std::false_type>,
 
                         std::tuple<BaseGraph::UndirectedGraph, char,                  std::true_type>,
                         std::tuple<BaseGraph::UndirectedGraph, char,                  std::false_type>,
@@ -24,7 +26,8 @@ using TestTypes = ::testing::Types<
                         std::tuple<BaseGraph::UndirectedGraph, std::string,           std::false_type>,
                         std::tuple<BaseGraph::UndirectedGraph, CustomHashableType,    std::true_type>,
                         std::tuple<BaseGraph::UndirectedGraph, CustomHashableType,    std::false_type>,
-                        std::tuple<BaseGraph::UndirectedGraph, CustomNonHashableType, std::false_type>
+                        std::tuple<BaseGraph::UndirectedGraph, CustomNonHashableType, std::false_type>,
+                        std::tuple<BaseGraph::UndirectedGraph, CustomOrderableType,   std::false_type>
                     >;
 
 #define GET_OTHER_LABELS getOtherLabels<typename std::tuple_element<1, TypeParam>::type>()
@@ -102,3 +105,206 @@ TYPED_TEST(VertexLabeledGraph, changeVertexLabelTo_frominexistentLabel_throwInva
         this->graph.changeVertexLabelTo(this->unusedLabels[0], this->labels[0]),
         std::invalid_argument);
 }
+
+TYPED_TEST(VertexLabeledGraph, findVertexIndices_existentAndInexistentLabels_missingLabelsFlagged) {
+    auto queriedLabels = this->labels;
+    queriedLabels.insert(queriedLabels.begin()+2, this->unusedLabels[0]);
+    std::vector<bool> missingLabels;
+
+    auto indices = this->graph.findVertexIndices(queriedLabels.begin(), queriedLabels.end(), missingLabels);
+
+    EXPECT_EQ(indices, std::vector<BaseGraph::VertexIndex>({0, 1, BaseGraph::SIZE_T_MAX, 2, 3, 4}));
+    EXPECT_EQ(missingLabels, std::vector<bool>({false, false, true, false, false, false}));
+}
+
+TYPED_TEST(VertexLabeledGraph, getLabelsFromIndices_validIndices_returnLabels) {
+    std::vector<BaseGraph::VertexIndex> indices = {4, 0, 2};
+    auto labels = this->graph.getLabelsFromIndices(indices.begin(), indices.end());
+
+    ASSERT_EQ(labels.size(), 3);
+    EXPECT_EQ(labels[0], this->labels[4]);
+    EXPECT_EQ(labels[1], this->labels[0]);
+    EXPECT_EQ(labels[2], this->labels[2]);
+
+    indices.push_back(5);
+    EXPECT_THROW(this->graph.getLabelsFromIndices(indices.begin(), indices.end()), std::out_of_range);
+}
+
+
+TEST(VertexLabeledGraphWithCustomHash, findVertexIndex_existentLabels_returnCorrectIndex) {
+    BaseGraph::VertexLabeledDirectedGraph<CustomNonHashableType, true, CustomLabelHash> graph;
+    auto labels = getLabels<CustomNonHashableType>();
+    for (auto& vertex: labels)
+        graph.addVertex(vertex);
+
+    for (BaseGraph::VertexIndex i=0; i<labels.size(); i++)
+        EXPECT_EQ(graph.findVertexIndex(labels[i]), i);
+    for (auto& vertex: getOtherLabels<CustomNonHashableType>())
+        EXPECT_FALSE(graph.isVertex(vertex));
+}
+
+TEST(VertexLabeledGraphWithCustomHash, addEdge_existentLabels_edgeExists) {
+    BaseGraph::VertexLabeledUndirectedGraph<CustomNonHashableType, true, CustomLabelHash> graph;
+    auto labels = getLabels<CustomNonHashableType>();
+    for (auto& vertex: labels)
+        graph.addVertex(vertex);
+
+    graph.addEdge(labels[0], labels[2]);
+    EXPECT_TRUE(graph.isEdge(labels[2], labels[0]));
+    EXPECT_EQ(graph, graph);
+}
+
+
+TEST(FrozenVertexLabeledGraph, findVertexIndex_manyLabels_returnCorrectIndices) {
+    BaseGraph::VertexLabeledDirectedGraph<std::string, true> graph;
+    for (size_t i=0; i<1000; i++)
+        graph.addVertex("vertex" + std::to_string(i));
+    graph.freeze();
+
+    EXPECT_TRUE(graph.isFrozen());
+    for (size_t i=0; i<1000; i++)
+        EXPECT_EQ(graph.findVertexIndex("vertex" + std::to_string(i)), i);
+    EXPECT_FALSE(graph.isVertex("vertex1000"));
+    EXPECT_THROW(graph.findVertexIndex("vertex1000"), std::invalid_argument);
+}
+
+TEST(FrozenVertexLabeledGraph, findVertexIndices_inParallel_returnCorrectIndices) {
+    BaseGraph::VertexLabeledDirectedGraph<std::string, true> graph;
+    std::vector<std::string> labels;
+    for (size_t i=0; i<1000; i++) {
+        graph.addVertex("vertex" + std::to_string(i));
+        labels.push_back("vertex" + std::to_string(999-i));
+    }
+    labels.push_back("vertex1000");
+    graph.freeze();
+
+    std::vector<bool> missingLabels;
+    auto indices = graph.findVertexIndices(labels.begin(), labels.end(), missingLabels, 4);
+
+    ASSERT_EQ(indices.size(), 1001);
+    for (size_t i=0; i<1000; i++) {
+        EXPECT_EQ(indices[i], 999-i);
+        EXPECT_FALSE(missingLabels[i]);
+    }
+    EXPECT_EQ(indices[1000], BaseGraph::SIZE_T_MAX);
+    EXPECT_TRUE(missingLabels[1000]);
+}
+
+TEST(VertexLabeledGraph, findVertexIndices_listOfLabelsInParallel_returnCorrectIndices) {
+    BaseGraph::VertexLabeledUndirectedGraph<int, true> graph;
+    std::list<int> labels;
+    for (int i=0; i<1000; i++) {
+        graph.addVertex(i);
+        labels.push_front(i);
+    }
+    labels.push_back(1000);
+
+    std::vector<bool> missingLabels;
+    auto indices = graph.findVertexIndices(labels.begin(), labels.end(), missingLabels, 4);
+
+    ASSERT_EQ(indices.size(), 1001);
+    for (size_t i=0; i<1000; i++) {
+        EXPECT_EQ(indices[i], 999-i);
+        EXPECT_FALSE(missingLabels[i]);
+    }
+    EXPECT_EQ(indices[1000], BaseGraph::SIZE_T_MAX);
+    EXPECT_TRUE(missingLabels[1000]);
+}
+
+TEST(FrozenVertexLabeledGraph, addVertexOrChangeLabel_frozenGraph_throwLogicError) {
+    BaseGraph::VertexLabeledUndirectedGraph<int, true> graph;
+    graph.addVertex(1);
+    graph.addVertex(2);
+    graph.freeze();
+
+    EXPECT_THROW(graph.addVertex(3), std::logic_error);
+    EXPECT_THROW(graph.changeVertexLabelTo(1, 3), std::logic_error);
+    graph.addEdge(1, 2);
+    EXPECT_TRUE(graph.isEdge(2, 1));
+}
+
+TEST(FrozenVertexLabeledGraph, unfreeze_frozenGraph_verticesCanBeAddedAndFound) {
+    BaseGraph::VertexLabeledUndirectedGraph<std::string, true> graph;
+    graph.addVertex("a");
+    graph.addVertex("b");
+    graph.freeze();
+    graph.unfreeze();
+
+    graph.addVertex("c");
+    graph.changeVertexLabelTo("a", "d");
+    EXPECT_FALSE(graph.isFrozen());
+    EXPECT_EQ(graph.findVertexIndex("d"), 0);
+    EXPECT_EQ(graph.findVertexIndex("b"), 1);
+    EXPECT_EQ(graph.findVertexIndex("c"), 2);
+    EXPECT_FALSE(graph.isVertex("a"));
+}
+
+// Gives the same hash to every group of 10 consecutive labels
+struct CollidingHash {
+    size_t operator()(int label) const { return label/10; }
+};
+
+TEST(FrozenVertexLabeledGraph, freeze_labelsWithSameHash_everyLabelFound) {
+    BaseGraph::VertexLabeledDirectedGraph<int, true, CollidingHash> graph;
+    for (int i=0; i<100; i++)
+        graph.addVertex(i);
+    graph.freeze();
+
+    EXPECT_EQ(graph.getFrozenIndex().size(), 100);
+    EXPECT_EQ(graph.getFrozenIndex().getCollisions().size(), 90);
+    for (int i=0; i<100; i++)
+        EXPECT_EQ(graph.findVertexIndex(i), i);
+    EXPECT_FALSE(graph.isVertex(100));
+    EXPECT_FALSE(graph.isVertex(-1));
+}
+
+TEST(FrozenVertexLabeledGraph, freeze_duplicateLabels_throwInvalidArgument) {
+    BaseGraph::VertexLabeledDirectedGraph<int, true> graph;
+    graph.addVertex(1);
+    graph.addVertex(1, true);
+
+    EXPECT_THROW(graph.freeze(), std::invalid_argument);
+    EXPECT_FALSE(graph.isFrozen());
+}
+
+
+TEST(StringLabeledGraph, getVertices_arenaStorage_returnVectorOfLabels) {
+    BaseGraph::VertexLabeledUndirectedGraph<std::string, true> graph;
+    graph.addVertex("a");
+    graph.addVertex("b");
+
+    std::vector<std::string> vertices = graph.getVertices();
+    EXPECT_EQ(vertices, std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(graph.getVertexLabels().size(), 2);
+    EXPECT_EQ(graph.getVertexLabels()[1], "b");
+}
+
+TEST(StringLabelArena, find_manyLabels_returnCorrectIndices) {
+    BaseGraph::StringLabelArena arena;
+    for (size_t i=0; i<1000; i++)
+        arena.push_back("vertex" + std::to_string(i));
+
+    EXPECT_EQ(arena.size(), 1000);
+    for (size_t i=0; i<1000; i++) {
+        EXPECT_EQ(arena.find("vertex" + std::to_string(i)), i);
+        EXPECT_EQ(arena[i], "vertex" + std::to_string(i));
+    }
+    EXPECT_EQ(arena.find("vertex1000"), BaseGraph::SIZE_T_MAX);
+    EXPECT_EQ(arena.find(""), BaseGraph::SIZE_T_MAX);
+}
+
+TEST(StringLabelArena, replace_repeatedly_oldLabelsRemovedAndStorageCompacted) {
+    BaseGraph::StringLabelArena arena;
+    for (size_t i=0; i<100; i++)
+        arena.push_back(std::to_string(i));
+
+    for (size_t i=0; i<100; i++)
+        arena.replace(i, "new" + std::to_string(i));
+
+    for (size_t i=0; i<100; i++) {
+        EXPECT_EQ(arena.find(std::to_string(i)), BaseGraph::SIZE_T_MAX);
+        EXPECT_EQ(arena.find("new" + std::to_string(i)), i);
+        EXPECT_EQ(arena[i], "new" + std::to_string(i));
+    }
+    EXPECT_LT(arena.getCharacterNumber(), 2*(3*100 + 190));
+}
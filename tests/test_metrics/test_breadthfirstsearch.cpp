@@ -0,0 +1,221 @@
+#include <queue>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/breadthfirstsearch.h"
+#include "BaseGraph/algorithms/graphpaths.h"
+#include "BaseGraph/algorithms/multisourcebfs.hpp"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+template <typename T>
+static vector<size_t> getQueueBFSDistances(const T& graph, VertexIndex source) {
+    vector<size_t> distances(graph.getSize(), SIZE_T_MAX);
+    queue<VertexIndex> verticesToProcess;
+    distances[source] = 0;
+    verticesToProcess.push(source);
+
+    while (!verticesToProcess.empty()) {
+        VertexIndex vertex = verticesToProcess.front();
+        verticesToProcess.pop();
+        for (VertexIndex neighbour: graph.getOutEdgesOfIdx(vertex))
+            if (distances[neighbour] == SIZE_T_MAX) {
+                distances[neighbour] = distances[vertex]+1;
+                verticesToProcess.push(neighbour);
+            }
+    }
+    return distances;
+}
+
+template <typename T>
+static void expectValidBFS(const T& graph, VertexIndex source) {
+    BreadthFirstSearch<T> bfs(graph);
+    bfs.run(source);
+
+    EXPECT_EQ(bfs.getDistances(), getQueueBFSDistances(graph, source));
+    for (VertexIndex vertex: graph) {
+        VertexIndex predecessor = bfs.getPredecessors()[vertex];
+        if (vertex == source || bfs.getDistances()[vertex] == SIZE_T_MAX)
+            EXPECT_EQ(predecessor, SIZE_T_MAX);
+        else {
+            EXPECT_TRUE(graph.isEdgeIdx(predecessor, vertex));
+            EXPECT_EQ(bfs.getDistances()[predecessor]+1, bfs.getDistances()[vertex]);
+        }
+    }
+}
+
+// A hub whose neighbourhood forces bottom-up steps, followed by a long path
+// that brings the search back to top-down steps
+template <typename T>
+static T getHubAndPathGraph() {
+    T graph(2001);
+    for (VertexIndex i=1; i<1000; i++) {
+        graph.addEdgeIdx(0, i);
+        graph.addEdgeIdx(i, i%500+1);
+    }
+    for (VertexIndex i=999; i<1999; i++)
+        graph.addEdgeIdx(i, i+1);
+    return graph;
+}
+
+// Two hubs joined by a path, so that the search switches to bottom-up steps twice
+static DirectedGraph getTwoHubsGraph() {
+    DirectedGraph graph(3000);
+    for (VertexIndex i=1; i<1000; i++) {
+        graph.addEdgeIdx(0, i);
+        graph.addEdgeIdx(i, i%500+1);
+    }
+    for (VertexIndex i=999; i<1499; i++)
+        graph.addEdgeIdx(i, i+1);
+    for (VertexIndex i=1500; i<3000; i++) {
+        graph.addEdgeIdx(1499, i);
+        graph.addEdgeIdx(i, (i+7)%1500+1500);
+    }
+    return graph;
+}
+
+
+TEST(BreadthFirstSearch, when_searchingHubAndPathUndirectedGraph_expect_sameDistancesAsQueueBFS) {
+    auto graph = getHubAndPathGraph<UndirectedGraph>();
+    expectValidBFS(graph, 0);
+    expectValidBFS(graph, 1500);
+    expectValidBFS(graph, 2000);
+}
+
+TEST(BreadthFirstSearch, when_searchingHubAndPathDirectedGraph_expect_sameDistancesAsQueueBFS) {
+    auto graph = getHubAndPathGraph<DirectedGraph>();
+    expectValidBFS(graph, 0);
+    expectValidBFS(graph, 1500);
+    expectValidBFS(graph, 10);
+}
+
+TEST(BreadthFirstSearch, when_searchingTwoHubsGraph_expect_sameDistancesAsQueueBFS) {
+    auto graph = getTwoHubsGraph();
+    expectValidBFS(graph, 0);
+    expectValidBFS(graph, 1200);
+}
+
+TEST_F(DirectedHouseGraph, when_searchingFromEveryVertex_expect_sameDistancesAsQueueBFS) {
+    for (VertexIndex vertex: graph)
+        expectValidBFS(graph, vertex);
+}
+
+TEST_F(UndirectedHouseGraph, when_searchingFromInexistentVertex_expect_throwOutOfRange) {
+    BreadthFirstSearch<UndirectedGraph> bfs(graph);
+    EXPECT_THROW(bfs.run(7), std::out_of_range);
+}
+
+
+TEST(MultiSourceBreadthFirstSearch, when_searchingFromEveryVertex_expect_sameDistancesAsSingleSourceBFS) {
+    DirectedGraph graph(150);  // More than two batches of sources
+    for (VertexIndex i=1; i<100; i++) {
+        graph.addEdgeIdx(0, i);
+        graph.addEdgeIdx(i, i%50+1);
+    }
+    for (VertexIndex i=99; i<148; i++)
+        graph.addEdgeIdx(i, i+1);
+    graph.addEdgeIdx(148, 20);
+
+    vector<vector<size_t>> distances(graph.getSize(), vector<size_t>(graph.getSize(), SIZE_T_MAX));
+    multiSourceBreadthFirstSearch(graph, [&](VertexIndex source, VertexIndex vertex, size_t distance) {
+        EXPECT_EQ(distances[source][vertex], SIZE_T_MAX);
+        distances[source][vertex] = distance;
+    });
+
+    for (VertexIndex source: graph)
+        EXPECT_EQ(distances[source], getQueueBFSDistances(graph, source));
+}
+
+TEST(MultiSourceBreadthFirstSearch, when_reusingWorkspace_expect_sameDistancesAsSingleSourceBFS) {
+    auto graph = getHubAndPathGraph<DirectedGraph>();
+    MultiSourceBFSWorkspace workspace;
+
+    for (VertexIndex source: {0, 1500, 10, 2000, 0}) {
+        vector<size_t> distances(graph.getSize(), SIZE_T_MAX);
+        multiSourceBreadthFirstSearch(graph, {source}, [&](VertexIndex, VertexIndex vertex, size_t distance) {
+            distances[vertex] = distance;
+        }, workspace);
+        EXPECT_EQ(distances, getQueueBFSDistances(graph, source));
+    }
+}
+
+
+
+TEST(BreadthFirstSearch, when_reusingWorkspaceForManySources_expect_sameDistancesAsQueueBFS) {
+    auto graph = getHubAndPathGraph<DirectedGraph>();
+    BreadthFirstSearch<DirectedGraph> workspace(graph);
+
+    for (VertexIndex source: {0, 1500, 10, 2000, 0})
+        EXPECT_EQ(findShortestPathLengthsFromVertexIdx(graph, source, workspace), getQueueBFSDistances(graph, source));
+}
+
+TEST_F(UndirectedHouseGraph, when_findingGeodesicsWithWorkspace_expect_validPaths) {
+    BreadthFirstSearch<UndirectedGraph> workspace(graph);
+
+    EXPECT_EQ(findGeodesicsIdx(graph, 4, 5, workspace), Path({4, 3, 5}));
+    EXPECT_EQ(findGeodesicsIdx(graph, 0, 6, workspace), Path());
+    auto geodesics = findGeodesicsFromVertexIdx(graph, 4, workspace);
+    EXPECT_EQ(geodesics[0], Path({4, 3, 0}));
+    EXPECT_EQ(geodesics[4], Path());
+    EXPECT_EQ(geodesics[6], Path());
+}
+
+TEST_F(UndirectedHouseGraph, when_usingWorkspaceOfOtherGraph_expect_throwInvalidArgument) {
+    UndirectedGraph otherGraph(7);
+    BreadthFirstSearch<UndirectedGraph> workspace(otherGraph);
+    EXPECT_THROW(findShortestPathLengthsFromVertexIdx(graph, 0, workspace), std::invalid_argument);
+}
+
+
+template <typename T>
+static void expectShortestPath(const T& graph, const Path& path, VertexIndex source, VertexIndex destination) {
+    size_t distance = getQueueBFSDistances(graph, source)[destination];
+    if (distance == SIZE_T_MAX) {
+        EXPECT_TRUE(path.empty());
+        return;
+    }
+    ASSERT_EQ(path.size(), distance+1);
+    EXPECT_EQ(path.front(), source);
+    EXPECT_EQ(path.back(), destination);
+    for (auto vertex=path.begin(), next=++path.begin(); next!=path.end(); ++vertex, ++next)
+        EXPECT_TRUE(graph.isEdgeIdx(*vertex, *next));
+}
+
+TEST(BidirectionalGeodesic, when_findingGeodesicsInUndirectedGraph_expect_shortestPaths) {
+    auto graph = getHubAndPathGraph<UndirectedGraph>();
+    for (VertexIndex source: {0, 5, 999, 1500, 2000})
+        for (VertexIndex destination: {0, 3, 700, 1000, 1999, 2000})
+            expectShortestPath(graph, findGeodesicsIdx(graph, source, destination), source, destination);
+}
+
+TEST(BidirectionalGeodesic, when_findingGeodesicsInDirectedGraph_expect_shortestPaths) {
+    auto graph = getHubAndPathGraph<DirectedGraph>();
+    auto inEdges = graph.getInEdges();
+    for (VertexIndex source: {0, 5, 999, 1500, 2000})
+        for (VertexIndex destination: {0, 3, 700, 1000, 1999, 2000}) {
+            expectShortestPath(graph, findGeodesicsIdx(graph, source, destination), source, destination);
+            expectShortestPath(graph, findGeodesicsIdx(graph, source, destination, inEdges), source, destination);
+        }
+}
+
+TEST(BidirectionalGeodesic, when_findingManyGeodesicsWithOneWorkspace_expect_shortestPaths) {
+    auto directedGraph = getTwoHubsGraph();
+    BreadthFirstSearch<DirectedGraph> directedWorkspace(directedGraph);
+    auto undirectedGraph = getHubAndPathGraph<UndirectedGraph>();
+    BreadthFirstSearch<UndirectedGraph> undirectedWorkspace(undirectedGraph);
+
+    for (VertexIndex source: {0, 5, 999, 1499, 1600})
+        for (VertexIndex destination: {0, 3, 700, 1200, 1500, 2999}) {
+            expectShortestPath(directedGraph, findGeodesicsIdx(directedGraph, source, destination, directedWorkspace), source, destination);
+            expectShortestPath(undirectedGraph, findGeodesicsIdx(undirectedGraph, source, destination%2001, undirectedWorkspace), source, destination%2001);
+        }
+
+    // A full search after the queries only sees its own distances
+    directedWorkspace.run(1499);
+    EXPECT_EQ(directedWorkspace.getDistances(), getQueueBFSDistances(directedGraph, 1499));
+    EXPECT_EQ(findGeodesicsIdx(directedGraph, 1600, 0, directedWorkspace), Path());
+}
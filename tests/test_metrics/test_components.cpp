@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/components.h"
+#include "BaseGraph/metrics/general.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+// Mostly isolated vertices and a few larger components
+static UndirectedGraph getSparseGraph(size_t verticesNumber, size_t edgeNumber, size_t seed) {
+    UndirectedGraph graph(verticesNumber);
+    mt19937_64 generator(seed);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, verticesNumber-1);
+    for (size_t i=0; i<edgeNumber; i++)
+        graph.addEdgeIdx(vertexDistribution(generator), vertexDistribution(generator));
+    return graph;
+}
+
+static void expectSameComponents(const UndirectedGraph& graph, const ComponentLabels& components) {
+    auto expectedComponents = findConnectedComponents(graph);
+    ASSERT_EQ(components.getComponentNumber(), expectedComponents.size());
+
+    size_t label = 0;
+    for (auto& component: expectedComponents) {
+        EXPECT_EQ(components.sizes[label], component.size());
+        for (VertexIndex vertex: component)
+            EXPECT_EQ(components.labels[vertex], label);
+        label++;
+    }
+}
+
+TEST_F(UndirectedHouseGraph, when_labelingComponents_expect_componentsOrderedBySmallestVertex) {
+    for (size_t threadNumber: {1, 2}) {
+        auto components = findConnectedComponentLabels(graph, threadNumber);
+        EXPECT_EQ(components.labels, vector<size_t>({0, 0, 0, 0, 0, 0, 1}));
+        EXPECT_EQ(components.sizes, vector<size_t>({6, 1}));
+    }
+}
+
+TEST(ComponentLabels, when_labelingRandomGraphs_expect_sameComponentsAsSearch) {
+    for (size_t edgeNumber: {100, 1000, 3000}) {
+        auto graph = getSparseGraph(2000, edgeNumber, edgeNumber);
+        auto components = findConnectedComponentLabels(graph);
+        expectSameComponents(graph, components);
+
+        auto parallelComponents = findConnectedComponentLabels(graph, 4);
+        EXPECT_EQ(parallelComponents.labels, components.labels);
+        EXPECT_EQ(parallelComponents.sizes, components.sizes);
+    }
+}
+
+TEST(ComponentLabels, when_graphHasManyIsolatedVertices_expect_everyVertexLabeled) {
+    auto graph = getSparseGraph(200000, 50, 1);
+    expectSameComponents(graph, findConnectedComponentLabels(graph, 0));
+}
+
+static DirectedGraph getSparseDirectedGraph(size_t verticesNumber, size_t edgeNumber, size_t seed) {
+    DirectedGraph graph(verticesNumber);
+    mt19937_64 generator(seed);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, verticesNumber-1);
+    for (size_t i=0; i<edgeNumber; i++)
+        graph.addEdgeIdx(vertexDistribution(generator), vertexDistribution(generator));
+    return graph;
+}
+
+static vector<vector<bool>> getReachabilities(const DirectedGraph& graph) {
+    vector<vector<bool>> reachable(graph.getSize(), vector<bool>(graph.getSize(), false));
+    for (VertexIndex source: graph) {
+        vector<VertexIndex> stack(1, source);
+        reachable[source][source] = true;
+        while (!stack.empty()) {
+            VertexIndex vertex = stack.back();
+            stack.pop_back();
+            for (VertexIndex neighbour: graph.getOutEdgesOfIdx(vertex))
+                if (!reachable[source][neighbour]) {
+                    reachable[source][neighbour] = true;
+                    stack.push_back(neighbour);
+                }
+        }
+    }
+    return reachable;
+}
+
+TEST_F(DirectedHouseGraph, when_findingStronglyConnectedComponents_expect_componentsOrderedBySmallestVertex) {
+    for (size_t threadNumber: {1, 4}) {
+        auto components = findStronglyConnectedComponents(graph, threadNumber);
+        EXPECT_EQ(components.labels, vector<size_t>({0, 0, 0, 0, 0, 1, 2}));
+        EXPECT_EQ(components.sizes, vector<size_t>({5, 1, 1}));
+    }
+}
+
+TEST_F(DirectedHouseGraph, when_findingWeaklyConnectedComponents_expect_componentsOfUndirectedGraph) {
+    auto expectedComponents = findConnectedComponentLabels(UndirectedGraph(graph));
+    for (size_t threadNumber: {1, 4}) {
+        auto components = findWeaklyConnectedComponents(graph, threadNumber);
+        EXPECT_EQ(components.labels, expectedComponents.labels);
+        EXPECT_EQ(components.sizes, expectedComponents.sizes);
+    }
+}
+
+TEST_F(DirectedHouseGraph, when_condensingStronglyConnectedComponents_expect_edgesBetweenComponents) {
+    auto condensationGraph = getCondensationGraph(graph, findStronglyConnectedComponents(graph));
+    EXPECT_EQ(condensationGraph.getSize(), 3);
+    EXPECT_EQ(condensationGraph.getEdgeNumber(), 1);
+    EXPECT_TRUE(condensationGraph.isEdgeIdx(0, 1));
+}
+
+TEST(StronglyConnectedComponents, when_findingComponentsOfRandomGraphs_expect_mutuallyReachableVertices) {
+    for (size_t edgeNumber: {200, 400, 800}) {
+        auto graph = getSparseDirectedGraph(300, edgeNumber, edgeNumber);
+        auto components = findStronglyConnectedComponents(graph);
+        auto reachable = getReachabilities(graph);
+        for (VertexIndex i: graph)
+            for (VertexIndex j: graph)
+                EXPECT_EQ(components.labels[i] == components.labels[j], reachable[i][j] && reachable[j][i]);
+
+        for (size_t threadNumber: {0, 4}) {
+            auto parallelComponents = findStronglyConnectedComponents(graph, threadNumber);
+            EXPECT_EQ(parallelComponents.labels, components.labels);
+            EXPECT_EQ(parallelComponents.sizes, components.sizes);
+        }
+    }
+}
+
+TEST(StronglyConnectedComponents, when_graphHasLongPaths_expect_noRecursionLimit) {
+    size_t verticesNumber = 200000;
+    DirectedGraph graph(verticesNumber);
+    for (VertexIndex vertex=0; vertex<verticesNumber-1; vertex++)
+        graph.addEdgeIdx(vertex, vertex+1);
+
+    EXPECT_EQ(findStronglyConnectedComponents(graph).getComponentNumber(), verticesNumber);
+    graph.addEdgeIdx(verticesNumber-1, 0);
+    for (size_t threadNumber: {1, 4})
+        EXPECT_EQ(findStronglyConnectedComponents(graph, threadNumber).sizes, vector<size_t>({verticesNumber}));
+}
+
+TEST_F(UndirectedHouseGraph, when_bindingIncrementalComponents_expect_componentsOfExistingEdges) {
+    IncrementalComponents components(graph);
+    EXPECT_EQ(components.getComponentNumber(), 2);
+    EXPECT_EQ(components.getLargestComponentSize(), 6);
+    EXPECT_TRUE(components.areConnectedIdx(0, 5));
+    EXPECT_FALSE(components.areConnectedIdx(0, 6));
+
+    components.addEdgeIdx(5, 6);
+    EXPECT_EQ(components.getComponentNumber(), 1);
+    EXPECT_EQ(components.getComponentSizeOfIdx(6), 7);
+    EXPECT_TRUE(graph.isEdgeIdx(5, 6));
+}
+
+TEST(IncrementalComponents, when_addingEdges_expect_sameComponentsAsSearch) {
+    UndirectedGraph graph(500);
+    IncrementalComponents components(graph);
+    EXPECT_EQ(components.getComponentNumber(), 500);
+    EXPECT_EQ(components.getLargestComponentSize(), 1);
+
+    mt19937_64 generator(42);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, 499);
+    for (size_t batch=0; batch<4; batch++) {
+        vector<Edge> edges;
+        for (size_t i=0; i<100; i++)
+            edges.push_back({vertexDistribution(generator), vertexDistribution(generator)});
+        auto largestComponentSizes = components.addEdgesIdx(edges);
+
+        ASSERT_EQ(largestComponentSizes.size(), edges.size());
+        EXPECT_TRUE(is_sorted(largestComponentSizes.begin(), largestComponentSizes.end()));
+        EXPECT_EQ(largestComponentSizes.back(), components.getLargestComponentSize());
+
+        auto labels = components.getComponentLabels();
+        expectSameComponents(graph, labels);
+        EXPECT_EQ(components.getComponentNumber(), labels.getComponentNumber());
+        EXPECT_EQ(components.getLargestComponentSize(), *max_element(labels.sizes.begin(), labels.sizes.end()));
+    }
+}
+
+TEST(IncrementalComponents, when_graphIsResized_expect_newVerticesIsolated) {
+    UndirectedGraph graph(2);
+    IncrementalComponents components(graph);
+    components.addEdgeIdx(0, 1);
+    graph.resize(4);
+    components.addEdgeIdx(1, 2);
+
+    EXPECT_EQ(components.getComponentNumber(), 2);
+    EXPECT_EQ(components.getLargestComponentSize(), 3);
+    EXPECT_THROW(components.addEdgeIdx(0, 4), out_of_range);
+    EXPECT_THROW(components.findRootIdx(4), out_of_range);
+}
@@ -8,6 +8,7 @@
 #include "BaseGraph/metrics/general.h"
 #include "BaseGraph/metrics/directed.h"
 #include "BaseGraph/metrics/undirected.h"
+#include "BaseGraph/parallel.hpp"
 
 
 using namespace std;
@@ -112,6 +113,14 @@ TEST(directedDensity, when_fiveEdgesAndNodes_expectDensityOfAQuarter){
     EXPECT_EQ(getDensity(graph), 0.25);
 }
 
+TEST(diameters, when_firstVertexUnreachable_expect_largestFiniteDistance){
+    DirectedGraph graph(4);
+    graph.addEdgeIdx(1, 2);
+    graph.addEdgeIdx(2, 3);
+    graph.addEdgeIdx(3, 0);
+    EXPECT_EQ(getDiameters(graph), vector<size_t>({0, 3, 2, 1}));
+}
+
 TEST(reciprocity, when_HalfReciprocitalEdges_expectHalf){
     DirectedGraph graph(5);
     graph.addReciprocalEdgeIdx(0, 1);
@@ -135,6 +144,26 @@ TEST(reciprocities, when_twoReciprocitalEdges_expectOne){
     EXPECT_EQ(reciprocalDegrees[4], 0);
 }
 
+TEST(reciprocities, when_computedWithManyThreads_expect_sameAsSerial){
+    DirectedGraph graph(200);
+    for (VertexIndex i=0; i<200; i++)
+        for (VertexIndex j: {(i+1)%200, (i*7)%200, (i*13+5)%200})
+            if (i != j && !graph.isEdgeIdx(i, j))
+                graph.addEdgeIdx(i, j);
+
+    auto reciprocalDegrees = getReciprocalDegrees(graph);
+    vector<size_t> expectedDegrees(graph.getSize(), 0);
+    for (VertexIndex i: graph)
+        for (VertexIndex j: graph.getOutEdgesOfIdx(i))
+            if (graph.isEdgeIdx(j, i))
+                expectedDegrees[i]++;
+    EXPECT_EQ(reciprocalDegrees, expectedDegrees);
+
+    setThreadNumber(4);
+    EXPECT_EQ(getReciprocalDegrees(graph), reciprocalDegrees);
+    setThreadNumber(1);
+}
+
 TEST(jaccardReciprocity, expect_correctReciprocities){
     DirectedGraph graph(5);
     graph.addReciprocalEdgeIdx(0, 2);
@@ -188,3 +217,19 @@ TEST_F(DirectedHouseGraph, expect_correctInDegreeHistogram) {
     map<size_t, size_t> expectedValues = {{0,1}, {1,4}, {2,1}, {3,1}};
     EXPECT_EQ(inDegreeHistogram, expectedValues);
 }
+
+TEST(DirectedBetweenness, expect_correctBetweenessesAndEdgeBetweenesses) {
+    DirectedGraph graph(5);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(0, 1, true);
+    graph.addEdgeIdx(0, 2);
+    graph.addEdgeIdx(1, 3);
+    graph.addEdgeIdx(2, 3);
+    graph.addEdgeIdx(3, 4);
+
+    EXPECT_EQ(getBetweennessCentralities(graph, true), vector<double>({0, 1, 1, 3, 0}));
+    EXPECT_EQ(getBetweennessCentralities(graph, false), vector<double>({0, 2, 2, 4, 0}));
+
+    map<Edge, double> expectedValues = {{{0, 1}, 2}, {{0, 2}, 2}, {{1, 3}, 3}, {{2, 3}, 3}, {{3, 4}, 4}};
+    EXPECT_EQ(getEdgeBetweennessCentralities(graph, true), expectedValues);
+}
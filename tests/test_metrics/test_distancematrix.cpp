@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/distancematrix.h"
+#include "BaseGraph/algorithms/graphpaths.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+template <typename Distance, typename T>
+static void expectExactDistances(const T& graph, const DistanceMatrix<Distance>& matrix) {
+    EXPECT_EQ(matrix.getSize(), graph.getSize());
+    for (VertexIndex i: graph) {
+        auto distances = findShortestPathLengthsFromVertexIdx(graph, i);
+        for (VertexIndex j: graph) {
+            EXPECT_EQ(matrix.getDistanceIdx(i, j), distances[j]) << "With i=" << i << " and j=" << j;
+            EXPECT_EQ(matrix.getRowIdx(i)[j], distances[j] == SIZE_T_MAX ? DistanceMatrix<Distance>::UNREACHABLE : distances[j]);
+        }
+    }
+}
+
+TEST_F(UndirectedHouseGraph, when_computingDistanceMatrix_expect_distancesOfEverySearch) {
+    expectExactDistances(graph, DistanceMatrix<uint8_t>(graph));
+    expectExactDistances(graph, DistanceMatrix<uint16_t>(graph, 3));
+}
+
+TEST_F(DirectedHouseGraph, when_computingDistanceMatrix_expect_distancesOfEverySearch) {
+    expectExactDistances(graph, DistanceMatrix<uint8_t>(graph, 0));
+    expectExactDistances(graph, DistanceMatrix<uint16_t>(graph));
+}
+
+TEST(DistanceMatrix, when_distancesDoNotFit_expect_throwOverflowError) {
+    UndirectedGraph graph(300);
+    for (VertexIndex i=0; i<299; i++)
+        graph.addEdgeIdx(i, i+1);
+
+    EXPECT_THROW(DistanceMatrix<uint8_t>(graph, 2), overflow_error);
+    expectExactDistances(graph, DistanceMatrix<uint16_t>(graph, 2));
+}
+
+TEST_F(DirectedHouseGraph, when_computingDistanceMatrixInFile_expect_sameDistancesWhenMappedAgain) {
+    string fileName = "distance_matrix_test.bin";
+    {
+        DistanceMatrix<uint16_t> matrix(graph, fileName, 2);
+        EXPECT_TRUE(matrix.isMapped());
+        expectExactDistances(graph, matrix);
+    }
+    DistanceMatrix<uint16_t> mappedMatrix;
+    mappedMatrix.mapBinaryFile(fileName);
+    expectExactDistances(graph, mappedMatrix);
+    EXPECT_THROW(DistanceMatrix<uint8_t>().mapBinaryFile(fileName), runtime_error);
+
+    DistanceMatrix<uint8_t>(graph).writeInBinaryFile(fileName);
+    DistanceMatrix<uint8_t> writtenMatrix;
+    writtenMatrix.mapBinaryFile(fileName);
+    expectExactDistances(graph, writtenMatrix);
+    remove(fileName.c_str());
+}
+
+TEST(DistanceMatrix, when_mappingFileWhoseSizeOverflows_expect_throwRuntimeError) {
+    // 2^32 vertices make a matrix of 2^64 bytes, which overflows to an empty matrix
+    string fileName = "distance_matrix_test.bin";
+    uint64_t header[4] = {0, 0, uint64_t(1) << 32, 1};
+    memcpy(header, "BaseGraphDist1", sizeof("BaseGraphDist1"));
+    ofstream(fileName, ios::binary).write((const char*) header, sizeof(header));
+
+    DistanceMatrix<uint8_t> matrix;
+    EXPECT_THROW(matrix.mapBinaryFile(fileName), runtime_error);
+    EXPECT_EQ(matrix.getSize(), 0);
+    remove(fileName.c_str());
+}
+
+TEST_F(UndirectedHouseGraph, when_queryingDistanceMatrixOutOfRange_expect_throwOutOfRange) {
+    DistanceMatrix<uint8_t> matrix(graph);
+    EXPECT_THROW(matrix.getDistanceIdx(0, 7), out_of_range);
+    EXPECT_THROW(matrix.getRowIdx(7), out_of_range);
+}
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/distanceoracle.h"
+#include "BaseGraph/algorithms/graphpaths.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+template <typename T>
+static void expectValidBounds(const T& graph, const LandmarkDistanceOracle& oracle) {
+    for (VertexIndex i: graph) {
+        auto distances = findShortestPathLengthsFromVertexIdx(graph, i);
+        for (VertexIndex j: graph) {
+            auto bounds = oracle.getDistanceBoundsIdx(i, j);
+            EXPECT_LE(bounds.first, distances[j]) << "With i=" << i << " and j=" << j;
+            EXPECT_GE(bounds.second, distances[j]) << "With i=" << i << " and j=" << j;
+        }
+    }
+}
+
+TEST_F(UndirectedHouseGraph, when_buildingLandmarkOracle_expect_boundsContainDistances) {
+    LandmarkDistanceOracle oracle(graph, 2, LandmarkDistanceOracle::HIGHEST_DEGREE, 2);
+    EXPECT_EQ(oracle.getLandmarks(), vector<VertexIndex>({3, 1}));
+    expectValidBounds(graph, oracle);
+
+    // Distances from a landmark are exact
+    EXPECT_EQ(oracle.getDistanceBoundsIdx(3, 5), (pair<size_t, size_t>(1, 1)));
+    EXPECT_EQ(oracle.getDistanceBoundsIdx(0, 1), (pair<size_t, size_t>(2, 2)));
+    EXPECT_EQ(oracle.getDistanceBoundsIdx(0, 6), make_pair(SIZE_T_MAX, SIZE_T_MAX));
+}
+
+TEST_F(UndirectedHouseGraph, when_selectingFarthestLandmarks_expect_landmarkInEveryComponent) {
+    LandmarkDistanceOracle oracle(graph, 2, LandmarkDistanceOracle::FARTHEST_POINT);
+    EXPECT_EQ(oracle.getLandmarks(), vector<VertexIndex>({3, 6}));
+    expectValidBounds(graph, oracle);
+}
+
+TEST_F(DirectedHouseGraph, when_buildingLandmarkOracle_expect_boundsContainDistances) {
+    for (size_t landmarkNumber: {1, 3, 7}) {
+        expectValidBounds(graph, LandmarkDistanceOracle(graph, landmarkNumber));
+        expectValidBounds(graph, LandmarkDistanceOracle(graph, landmarkNumber, LandmarkDistanceOracle::FARTHEST_POINT));
+    }
+
+    LandmarkDistanceOracle oracle(graph, 7);
+    for (VertexIndex i: graph) {
+        auto distances = findShortestPathLengthsFromVertexIdx(graph, i);
+        for (VertexIndex j: graph)
+            EXPECT_EQ(oracle.getDistanceBoundsIdx(i, j), make_pair(distances[j], distances[j]));
+    }
+}
+
+TEST_F(DirectedHouseGraph, when_writingAndLoadingLandmarkOracle_expect_sameBounds) {
+    LandmarkDistanceOracle oracle(graph, 2);
+    stringstream stream;
+    oracle.writeInBinaryStream(stream);
+
+    LandmarkDistanceOracle loadedOracle;
+    loadedOracle.loadFromBinaryStream(stream);
+    EXPECT_TRUE(loadedOracle.isDirected());
+    EXPECT_EQ(loadedOracle.getLandmarks(), oracle.getLandmarks());
+    for (VertexIndex i: graph)
+        for (VertexIndex j: graph)
+            EXPECT_EQ(loadedOracle.getDistanceBoundsIdx(i, j), oracle.getDistanceBoundsIdx(i, j));
+
+    stringstream corruptedStream("BaseGraphLandmarks1");
+    EXPECT_THROW(loadedOracle.loadFromBinaryStream(corruptedStream), runtime_error);
+    EXPECT_EQ(loadedOracle.getLandmarks(), oracle.getLandmarks());
+}
+
+// Header of an oracle file followed by a few bytes of distances
+static string getLandmarkOracleHeader(uint64_t verticesNumber, uint8_t directed, uint64_t landmarkNumber) {
+    string header("BaseGraphLandmarks1", sizeof("BaseGraphLandmarks1"));
+    header.append((const char*) &verticesNumber, sizeof(verticesNumber));
+    header.append((const char*) &directed, sizeof(directed));
+    header.append((const char*) &landmarkNumber, sizeof(landmarkNumber));
+    return header + string(64, '\0');
+}
+
+TEST(LandmarkDistanceOracle, when_loadingSizesLargerThanStream_expect_throwRuntimeError) {
+    LandmarkDistanceOracle oracle;
+    for (auto sizes: {make_pair(uint64_t(1) << 40, uint64_t(2)),
+                      make_pair(uint64_t(1) << 40, uint64_t(1) << 30),
+                      make_pair(uint64_t(1) << 62, uint64_t(1) << 62)}) {
+        stringstream stream(getLandmarkOracleHeader(sizes.first, 1, sizes.second));
+        EXPECT_THROW(oracle.loadFromBinaryStream(stream), runtime_error);
+    }
+    EXPECT_EQ(oracle.getSize(), 0);
+}
+
+TEST_F(UndirectedHouseGraph, when_queryingVertexOutOfRange_expect_throwOutOfRange) {
+    LandmarkDistanceOracle oracle(graph, 1);
+    EXPECT_THROW(oracle.getDistanceBoundsIdx(0, 7), out_of_range);
+    EXPECT_THROW(LandmarkDistanceOracle(graph, 0), invalid_argument);
+}
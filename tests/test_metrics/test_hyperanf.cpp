@@ -0,0 +1,84 @@
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/hyperanf.h"
+#include "BaseGraph/algorithms/graphpaths.h"
+#include "BaseGraph/algorithms/randomgraphs.h"
+#include "BaseGraph/metrics/general.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+template <typename T>
+static vector<double> getExactPairNumbers(const T& graph) {
+    vector<double> pairNumbers;
+    for (VertexIndex i: graph)
+        for (size_t distance: findShortestPathLengthsFromVertexIdx(graph, i)) {
+            if (distance == SIZE_T_MAX)
+                continue;
+            if (pairNumbers.size() <= distance)
+                pairNumbers.resize(distance+1, 0);
+            pairNumbers[distance]++;
+        }
+    for (size_t distance=1; distance<pairNumbers.size(); distance++)
+        pairNumbers[distance] += pairNumbers[distance-1];
+    return pairNumbers;
+}
+
+// With 2^16 registers, small counters are exact up to register collisions
+template <typename T>
+static void expectNearlyExactEstimates(const T& graph) {
+    rng.seed(42);
+    auto neighbourhoodFunction = estimateNeighbourhoodFunction(graph, 16);
+    auto exactPairNumbers = getExactPairNumbers(graph);
+
+    ASSERT_EQ(neighbourhoodFunction.pairNumbers.size(), exactPairNumbers.size());
+    for (size_t distance=0; distance<exactPairNumbers.size(); distance++)
+        EXPECT_NEAR(neighbourhoodFunction.pairNumbers[distance], exactPairNumbers[distance], 0.01);
+
+    auto harmonicCentralities = getHarmonicCentralities(graph);
+    for (VertexIndex vertex: graph)
+        EXPECT_NEAR(neighbourhoodFunction.harmonicCentralities[vertex], harmonicCentralities[vertex], 0.01);
+}
+
+TEST_F(UndirectedHouseGraph, when_estimatingNeighbourhoodFunctionWithManyRegisters_expect_nearlyExactEstimates) {
+    expectNearlyExactEstimates(graph);
+
+    rng.seed(42);
+    auto neighbourhoodFunction = estimateNeighbourhoodFunction(graph, 16);
+    // 16 pairs at distance 1 and 14 at distance 2
+    EXPECT_NEAR(neighbourhoodFunction.getAverageDistance(), 44./30, 1e-3);
+    EXPECT_NEAR(neighbourhoodFunction.getDistanceDistribution()[1], 16./30, 1e-3);
+    EXPECT_NEAR(neighbourhoodFunction.getEffectiveDiameter(0.5), 15./16, 1e-3);
+    EXPECT_NEAR(neighbourhoodFunction.getEffectiveDiameter(1), 2, 1e-3);
+}
+
+TEST_F(DirectedHouseGraph, when_estimatingNeighbourhoodFunctionWithManyRegisters_expect_nearlyExactEstimates) {
+    expectNearlyExactEstimates(graph);
+}
+
+TEST(HyperANF, when_estimatingOnPathWithThreads_expect_sameCountersAndAccurateAverage) {
+    UndirectedGraph graph(300);
+    for (VertexIndex i=0; i<299; i++)
+        graph.addEdgeIdx(i, i+1);
+
+    rng.seed(1);
+    auto neighbourhoodFunction = estimateNeighbourhoodFunction(graph, 10);
+    rng.seed(1);
+    auto threadedNeighbourhoodFunction = estimateNeighbourhoodFunction(graph, 10, 4);
+
+    EXPECT_EQ(neighbourhoodFunction.harmonicCentralities, threadedNeighbourhoodFunction.harmonicCentralities);
+    EXPECT_EQ(neighbourhoodFunction.pairNumbers.size(), 300);
+    EXPECT_NEAR(neighbourhoodFunction.getAverageDistance(), 301./3, 301./3*0.1);
+}
+
+TEST(HyperANF, when_registerNumberIsOutOfBounds_expect_throwInvalidArgument) {
+    UndirectedGraph graph(3);
+    EXPECT_THROW(estimateNeighbourhoodFunction(graph, 3), invalid_argument);
+    EXPECT_THROW(estimateNeighbourhoodFunction(graph, 17), invalid_argument);
+    EXPECT_THROW(estimateNeighbourhoodFunction(graph, 4).getEffectiveDiameter(0), invalid_argument);
+}
@@ -0,0 +1,132 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/prunedlandmarklabeling.h"
+#include "BaseGraph/algorithms/graphpaths.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+template <typename T>
+static void expectExactDistances(const T& graph, const PrunedLandmarkLabeling& index) {
+    EXPECT_EQ(index.getSize(), graph.getSize());
+    for (VertexIndex i: graph) {
+        auto distances = findShortestPathLengthsFromVertexIdx(graph, i);
+        for (VertexIndex j: graph)
+            EXPECT_EQ(index.getDistanceIdx(i, j), distances[j]) << "With i=" << i << " and j=" << j;
+    }
+}
+
+// Two dense-ish random components and a few isolated vertices
+template <typename T>
+static T getSparseRandomGraph() {
+    T graph(300);
+    mt19937_64 generator(42);
+    uniform_int_distribution<VertexIndex> firstHalf(0, 149), secondHalf(150, 289);
+    for (size_t i=0; i<400; i++) {
+        graph.addEdgeIdx(firstHalf(generator), firstHalf(generator));
+        graph.addEdgeIdx(secondHalf(generator), secondHalf(generator));
+    }
+    return graph;
+}
+
+
+TEST_F(UndirectedHouseGraph, when_buildingPrunedLandmarkLabeling_expect_exactDistances) {
+    for (size_t bitParallelRootNumber: {0, 1, 16}) {
+        PrunedLandmarkLabeling index(graph, bitParallelRootNumber);
+        EXPECT_FALSE(index.isDirected());
+        expectExactDistances(graph, index);
+    }
+    EXPECT_EQ(PrunedLandmarkLabeling(graph, 0).getDistanceIdx(0, 6), SIZE_T_MAX);
+}
+
+TEST_F(DirectedHouseGraph, when_buildingPrunedLandmarkLabeling_expect_exactDistances) {
+    PrunedLandmarkLabeling index(graph);
+    EXPECT_TRUE(index.isDirected());
+    expectExactDistances(graph, index);
+}
+
+TEST(PrunedLandmarkLabeling, when_buildingFromRandomGraphs_expect_exactDistances) {
+    auto undirectedGraph = getSparseRandomGraph<UndirectedGraph>();
+    expectExactDistances(undirectedGraph, PrunedLandmarkLabeling(undirectedGraph, 0));
+    expectExactDistances(undirectedGraph, PrunedLandmarkLabeling(undirectedGraph, 4));
+    expectExactDistances(undirectedGraph, PrunedLandmarkLabeling(undirectedGraph));
+
+    auto directedGraph = getSparseRandomGraph<DirectedGraph>();
+    expectExactDistances(directedGraph, PrunedLandmarkLabeling(directedGraph));
+}
+
+TEST(PrunedLandmarkLabeling, when_buildingFromStar_expect_hubInEveryLabel) {
+    UndirectedGraph graph(256);
+    for (VertexIndex i=1; i<256; i++)
+        graph.addEdgeIdx(0, i);
+
+    PrunedLandmarkLabeling index(graph, 0);
+    expectExactDistances(graph, index);
+    EXPECT_EQ(index.getLabelEntryNumber(), 1+2*255);
+}
+
+TEST_F(UndirectedHouseGraph, when_writingLoadingAndMappingPrunedLandmarkLabeling_expect_sameDistances) {
+    string fileName = "pruned_landmark_labeling_test.bin";
+    PrunedLandmarkLabeling index(graph, 2);
+    index.writeInBinaryFile(fileName);
+
+    PrunedLandmarkLabeling loadedIndex, mappedIndex;
+    loadedIndex.loadFromBinaryFile(fileName);
+    mappedIndex.mapBinaryFile(fileName);
+    EXPECT_FALSE(loadedIndex.isMapped());
+    EXPECT_EQ(loadedIndex.getBitParallelRootNumber(), 2);
+    EXPECT_EQ(mappedIndex.getLabelEntryNumber(), index.getLabelEntryNumber());
+    expectExactDistances(graph, loadedIndex);
+    expectExactDistances(graph, mappedIndex);
+
+    PrunedLandmarkLabeling movedIndex(move(mappedIndex));
+    EXPECT_EQ(mappedIndex.getSize(), 0);
+    expectExactDistances(graph, movedIndex);
+
+    ofstream(fileName, ios::binary) << "BaseGraphPLL1";
+    EXPECT_THROW(loadedIndex.loadFromBinaryFile(fileName), runtime_error);
+    expectExactDistances(graph, loadedIndex);
+    remove(fileName.c_str());
+}
+
+// Copies the file with the 4 bytes at the given position replaced by value
+static void writeCorruptedCopy(const string& fileName, const string& copyName, size_t position, uint32_t value) {
+    ifstream file(fileName, ios::binary);
+    string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    content.replace(position, sizeof(value), (const char*) &value, sizeof(value));
+    ofstream(copyName, ios::binary) << content;
+}
+
+TEST_F(UndirectedHouseGraph, when_loadingOrMappingCorruptedRanksOrLabels_expect_throwRuntimeError) {
+    string fileName = "pruned_landmark_labeling_test.bin", copyName = "pruned_landmark_labeling_copy.bin";
+    PrunedLandmarkLabeling(graph, 0).writeInBinaryFile(fileName);
+
+    // Header of 56 bytes, 7 ranks padded to 32 bytes, then 8 offsets and the hubs
+    const size_t ranksPosition = 56, offsetsPosition = 88, hubsPosition = 152;
+    for (auto corruption: {make_pair(ranksPosition, (uint32_t) 7),
+                           make_pair(offsetsPosition+8, (uint32_t) 0),
+                           make_pair(hubsPosition, (uint32_t) 1000)}) {
+        writeCorruptedCopy(fileName, copyName, corruption.first, corruption.second);
+        PrunedLandmarkLabeling index;
+        EXPECT_THROW(index.loadFromBinaryFile(copyName), runtime_error);
+        EXPECT_THROW(index.mapBinaryFile(copyName), runtime_error);
+        EXPECT_EQ(index.getSize(), 0);
+    }
+    remove(fileName.c_str());
+    remove(copyName.c_str());
+}
+
+TEST_F(DirectedHouseGraph, when_queryingVertexOutOfRange_expect_throwOutOfRange) {
+    PrunedLandmarkLabeling index(graph);
+    EXPECT_THROW(index.getDistanceIdx(0, 7), out_of_range);
+    EXPECT_THROW(index.getDistanceIdx(7, 0), out_of_range);
+    EXPECT_THROW(PrunedLandmarkLabeling().writeInBinaryFile("pruned_landmark_labeling_test.bin"), logic_error);
+}
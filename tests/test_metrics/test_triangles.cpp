@@ -0,0 +1,85 @@
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "fixtures.hpp"
+#include "BaseGraph/algorithms/triangles.h"
+#include "BaseGraph/metrics/undirected.h"
+
+
+using namespace std;
+using namespace BaseGraph;
+
+
+static UndirectedGraph getRandomGraph(size_t verticesNumber, size_t edgeNumber, size_t seed) {
+    UndirectedGraph graph(verticesNumber);
+    mt19937_64 generator(seed);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, verticesNumber-1);
+    for (size_t i=0; i<edgeNumber; i++)
+        graph.addEdgeIdx(vertexDistribution(generator), vertexDistribution(generator));
+    return graph;
+}
+
+static TriangleCounts countTrianglesByBruteForce(const UndirectedGraph& graph) {
+    TriangleCounts counts;
+    counts.vertexTriangleNumbers.assign(graph.getSize(), 0);
+    for (VertexIndex i: graph)
+        for (VertexIndex j=i+1; j<graph.getSize(); j++)
+            if (graph.isEdgeIdx(i, j))
+                for (VertexIndex k=j+1; k<graph.getSize(); k++)
+                    if (graph.isEdgeIdx(i, k) && graph.isEdgeIdx(j, k)) {
+                        counts.triangleNumber++;
+                        counts.vertexTriangleNumbers[i]++;
+                        counts.vertexTriangleNumbers[j]++;
+                        counts.vertexTriangleNumbers[k]++;
+                    }
+    return counts;
+}
+
+static void expectCountsOfBruteForce(const UndirectedGraph& graph) {
+    auto expectedCounts = countTrianglesByBruteForce(graph);
+    TriangleEnumerator enumerator(graph);
+    for (size_t threadNumber: {1, 3}) {
+        auto counts = enumerator.countTriangles(threadNumber);
+        EXPECT_EQ(counts.triangleNumber, expectedCounts.triangleNumber);
+        EXPECT_EQ(counts.vertexTriangleNumbers, expectedCounts.vertexTriangleNumbers);
+    }
+    EXPECT_EQ(enumerator.findAllTriangles().size(), expectedCounts.triangleNumber);
+    for (VertexIndex vertex: graph)
+        EXPECT_EQ(countTrianglesAroundVertexIdx(graph, vertex), expectedCounts.vertexTriangleNumbers[vertex]);
+}
+
+TEST_F(UndirectedHouseGraph, when_enumeratingTriangles_expect_countsOfEveryVertex) {
+    auto counts = TriangleEnumerator(graph).countTriangles();
+    EXPECT_EQ(counts.triangleNumber, 3);
+    EXPECT_EQ(counts.vertexTriangleNumbers, vector<size_t>({1, 2, 2, 3, 1, 0, 0}));
+}
+
+TEST(TriangleEnumerator, when_enumeratingTrianglesOfRandomGraphs_expect_countsOfBruteForce) {
+    for (size_t edgeNumber: {100, 800, 3000})
+        expectCountsOfBruteForce(getRandomGraph(120, edgeNumber, edgeNumber));
+}
+
+TEST(TriangleEnumerator, when_outNeighboursDifferInLength_expect_countsOfBruteForce) {
+    // Vertex 0 has the out neighbours {1, 2} while vertex 1 has the clique of
+    // vertices 2 to 71 as out neighbours, which are found by galloping
+    UndirectedGraph graph(72+5*70);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(0, 2);
+    for (VertexIndex vertex=2; vertex<72; vertex++) {
+        graph.addEdgeIdx(1, vertex);
+        for (VertexIndex neighbour=vertex+1; neighbour<72; neighbour++)
+            graph.addEdgeIdx(vertex, neighbour);
+        for (size_t leaf=0; leaf<5; leaf++)
+            graph.addEdgeIdx(vertex, 72+5*(vertex-2)+leaf);
+    }
+    expectCountsOfBruteForce(graph);
+}
+
+TEST_F(UndirectedHouseGraph, when_graphHasSelfLoopsAndDuplicateEdges_expect_themIgnored) {
+    graph.addEdgeIdx(3, 3, true);
+    graph.addEdgeIdx(2, 3, true);
+    auto counts = TriangleEnumerator(graph).countTriangles();
+    EXPECT_EQ(counts.triangleNumber, 3);
+    EXPECT_EQ(counts.vertexTriangleNumbers, vector<size_t>({1, 2, 2, 3, 1, 0, 0}));
+}
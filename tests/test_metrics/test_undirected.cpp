@@ -1,5 +1,10 @@
 #include <vector>
 #include <list>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -8,6 +13,7 @@
 #include "BaseGraph/metrics/general.h"
 #include "BaseGraph/metrics/directed.h"
 #include "BaseGraph/metrics/undirected.h"
+#include "BaseGraph/parallel.hpp"
 
 
 using namespace std;
@@ -81,6 +87,98 @@ TEST_F(TreeLikeGraph, when_findingAllPredecessors_expect_returnEveryPath){
     EXPECT_EQ(geodesics, list<list<BaseGraph::VertexIndex>>( {{0, 1}} ));
 }
 
+TEST_F(TreeLikeGraph, when_findingPredecessorDAG_expect_sameAsPredecessorLists){
+    graph.addEdgeIdx(4, 6, true);
+    auto predecessorDAG = findPredecessorDAGOfVertexIdx(graph, 0);
+    auto predecessors = findAllPredecessorsOfVertexIdx(graph, 0);
+
+    EXPECT_EQ(predecessorDAG.source, 0);
+    EXPECT_EQ(predecessorDAG.distances, predecessors.first);
+    EXPECT_EQ(predecessorDAG.offsets, vector<size_t>({0, 0, 1, 2, 3, 5, 6, 9, 10}));
+    EXPECT_EQ(predecessorDAG.predecessors, vector<VertexIndex>({0, 0, 1, 1, 2, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(predecessors.second[6], Path({3, 4, 5}));
+
+    EXPECT_EQ(findMultiplePathsToVertexFromPredecessorDAGIdx(predecessorDAG, 7),
+            findMultiplePathsToVertexFromPredecessorsIdx(graph, 0, 7, predecessors));
+}
+
+TEST_F(TreeLikeGraph, when_generatingGeodesics_expect_sameGeodesicsAsEnumeration){
+    for (VertexIndex i: graph) {
+        for (VertexIndex j: graph) {
+            set<vector<VertexIndex>> expectedGeodesics, geodesics;
+            for (auto& geodesic: findAllGeodesicsIdx(graph, i, j))
+                expectedGeodesics.insert(vector<VertexIndex>(geodesic.begin(), geodesic.end()));
+
+            auto generator = generateAllGeodesicsIdx(graph, i, j);
+            size_t generatedNumber = 0;
+            while (generator.next()) {
+                geodesics.insert(generator.getGeodesic());
+                generatedNumber++;
+            }
+            EXPECT_FALSE(generator.next());
+            EXPECT_EQ(geodesics, expectedGeodesics);
+            EXPECT_EQ(generatedNumber, expectedGeodesics.size());
+            EXPECT_EQ(countAllGeodesicsIdx(graph, i, j), expectedGeodesics.size());
+        }
+    }
+    EXPECT_EQ(countAllGeodesicsFromVertexIdx(graph, 0), vector<size_t>({1, 1, 1, 1, 2, 1, 4, 4}));
+}
+
+TEST_F(TreeLikeGraph, when_generatingGeodesicsOfBorrowedDAG_expect_sameGeodesicsAsSharedDAG){
+    auto predecessorDAG = findPredecessorDAGOfVertexIdx(graph, 0);
+    GeodesicGenerator generator(predecessorDAG, 7);
+    GeodesicGenerator sharedGenerator(std::make_shared<PredecessorDAG>(predecessorDAG), 7);
+
+    while (sharedGenerator.next()) {
+        ASSERT_TRUE(generator.next());
+        EXPECT_EQ(generator.getGeodesic(), sharedGenerator.getGeodesic());
+    }
+    EXPECT_FALSE(generator.next());
+}
+
+TEST(UndirectedGeodesics, when_geodesicsAreTooManyToEnumerate_expect_countAndFirstGeodesics){
+    // Chain of 40 squares: each square doubles the number of geodesics
+    UndirectedGraph graph(121);
+    for (VertexIndex square=0; square<40; square++) {
+        VertexIndex vertex = 3*square;
+        graph.addEdgeIdx(vertex, vertex+1);
+        graph.addEdgeIdx(vertex, vertex+2);
+        graph.addEdgeIdx(vertex+1, vertex+3);
+        graph.addEdgeIdx(vertex+2, vertex+3);
+    }
+    EXPECT_EQ(countAllGeodesicsIdx(graph, 0, 120), size_t(1) << 40);
+
+    auto generator = generateAllGeodesicsIdx(graph, 0, 120);
+    for (size_t i=0; i<1000; i++) {
+        ASSERT_TRUE(generator.next());
+        EXPECT_EQ(generator.getGeodesic().size(), 81);
+    }
+}
+
+TEST(UndirectedGeodesics, when_geodesicNumberOverflows_expect_throwOverflowError){
+    UndirectedGraph graph(196);
+    for (VertexIndex square=0; square<65; square++) {
+        VertexIndex vertex = 3*square;
+        graph.addEdgeIdx(vertex, vertex+1);
+        graph.addEdgeIdx(vertex, vertex+2);
+        graph.addEdgeIdx(vertex+1, vertex+3);
+        graph.addEdgeIdx(vertex+2, vertex+3);
+    }
+    EXPECT_THROW(countAllGeodesicsIdx(graph, 0, 195), std::overflow_error);
+    EXPECT_EQ(countAllGeodesicsIdx(graph, 0, 189), size_t(1) << 63);
+}
+
+TEST_F(UndirectedHouseGraph, when_generatingGeodesicsToUnreachableVertex_expect_noGeodesic){
+    auto generator = generateAllGeodesicsIdx(graph, 0, 6);
+    EXPECT_FALSE(generator.next());
+    EXPECT_EQ(countAllGeodesicsIdx(graph, 0, 6), 0);
+
+    generator = generateAllGeodesicsIdx(graph, 0, 0);
+    ASSERT_TRUE(generator.next());
+    EXPECT_EQ(generator.getGeodesic(), vector<VertexIndex>({0}));
+    EXPECT_FALSE(generator.next());
+}
+
 TEST_F(UndirectedHouseGraph, when_findingConnectedComponents_expect_returnsCorrectComponents){
     list<BaseGraph::Component> components = findConnectedComponents(graph);
     auto component = components.begin();
@@ -118,6 +216,43 @@ TEST_F(ThreeComponentsGraph, when_findingShortestPathsDistribution_expect_return
     EXPECT_EQ(shortestPathDistribution, expectedValues);
 }
 
+TEST_F(ThreeComponentsGraph, when_computingShortestPathMetricsTogether_expect_sameAsSeparateMetrics) {
+    for (size_t threadNumber: {1, 3}) {
+        auto metrics = getShortestPathMetrics(graph, ALL_SHORTEST_PATH_METRICS, threadNumber);
+        EXPECT_EQ(metrics.closenessCentralities, getClosenessCentralities(graph));
+        EXPECT_EQ(metrics.harmonicCentralities, getHarmonicCentralities(graph));
+        EXPECT_EQ(metrics.shortestPathAverages, getShortestPathAverages(graph));
+        EXPECT_EQ(metrics.shortestPathHarmonicAverages, getShortestPathHarmonicAverages(graph));
+        EXPECT_EQ(metrics.eccentricities, getDiameters(graph));
+        EXPECT_EQ(metrics.shortestPathsDistribution, getShortestPathsDistribution(graph));
+    }
+
+    auto metrics = getShortestPathMetrics(graph, HARMONIC_CENTRALITIES | ECCENTRICITIES);
+    EXPECT_TRUE(metrics.closenessCentralities.empty());
+    EXPECT_TRUE(metrics.shortestPathsDistribution.empty());
+    EXPECT_EQ(metrics.eccentricities.size(), graph.getSize());
+}
+
+TEST(UndirectedThreadNumber, when_computingPerVertexMetricsWithThreads_expect_sameAsSerial) {
+    mt19937_64 generator(3);
+    uniform_int_distribution<VertexIndex> vertexDistribution(0, 299);
+    UndirectedGraph graph(300);
+    for (size_t i=0; i<1500; i++)
+        graph.addEdgeIdx(vertexDistribution(generator), vertexDistribution(generator) % 20);
+
+    auto localClusteringCoefficients = getLocalClusteringCoefficients(graph);
+    auto neighbourDegreeSpectrum = getNeighbourDegreeSpectrum(graph);
+    auto shortestPathsDistribution = getShortestPathsDistribution(graph);
+    auto harmonicAverages = getShortestPathHarmonicAverages(graph);
+
+    setThreadNumber(4);
+    EXPECT_EQ(getLocalClusteringCoefficients(graph), localClusteringCoefficients);
+    EXPECT_EQ(getNeighbourDegreeSpectrum(graph), neighbourDegreeSpectrum);
+    EXPECT_EQ(getShortestPathsDistribution(graph), shortestPathsDistribution);
+    EXPECT_EQ(getShortestPathHarmonicAverages(graph), harmonicAverages);
+    setThreadNumber(1);
+}
+
 TEST_F(UndirectedHouseGraph, when_findingClosenessCentrality_expect_returnsCorrectCentrality){
     std::vector<double> expectedValues = {
         5./8, 5./7, 5./7, 1, 5./8, 5./9, 0
@@ -144,6 +279,34 @@ TEST_F(TreeLikeGraph, when_findingDiameters_expect_correctDiameters){
     EXPECT_EQ(diameters[7], 4);
 }
 
+static vector<size_t> getEccentricitiesFromEverySearch(const UndirectedGraph& graph) {
+    vector<size_t> eccentricities(graph.getSize(), 0);
+    for (VertexIndex i: graph)
+        for (size_t distance: findShortestPathLengthsFromVertexIdx(graph, i))
+            if (distance != SIZE_T_MAX && distance > eccentricities[i])
+                eccentricities[i] = distance;
+    return eccentricities;
+}
+
+TEST_F(UndirectedHouseGraph, when_boundingEccentricities_expect_sameAsEverySearch){
+    EXPECT_EQ(getEccentricities(graph), getEccentricitiesFromEverySearch(graph));
+    EXPECT_EQ(getDiameter(graph), 2);
+}
+
+TEST(UndirectedEccentricities, when_boundingEccentricitiesOfRandomGraphs_expect_sameAsEverySearch){
+    mt19937_64 generator(7);
+    for (size_t edgeNumber: {100, 150, 300}) {
+        UndirectedGraph graph(120);
+        uniform_int_distribution<VertexIndex> vertexDistribution(0, 119);
+        for (size_t i=0; i<edgeNumber; i++)
+            graph.addEdgeIdx(vertexDistribution(generator), vertexDistribution(generator));
+
+        auto eccentricities = getEccentricitiesFromEverySearch(graph);
+        EXPECT_EQ(getEccentricities(graph), eccentricities);
+        EXPECT_EQ(getDiameter(graph), *max_element(eccentricities.begin(), eccentricities.end()));
+    }
+}
+
 TEST_F(TreeLikeGraph, expect_correctBetweenesses){
     std::vector<double> betweenesses = getBetweennessCentralities(graph, true);
     std::vector<double> expectedValues = {
@@ -152,6 +315,67 @@ TEST_F(TreeLikeGraph, expect_correctBetweenesses){
     EXPECT_EQ(betweenesses, expectedValues);
 }
 
+TEST_F(TreeLikeGraph, when_computingBetweenessesWithoutNormalization_expect_numberOfGeodesicsThroughVertex){
+    vector<double> expectedValues(graph.getSize(), 0);
+    for (VertexIndex i: graph) {
+        auto predecessors = findAllPredecessorsOfVertexIdx(graph, i);
+        for (VertexIndex j=i+1; j<graph.getSize(); j++)
+            for (auto& geodesic: findMultiplePathsToVertexFromPredecessorsIdx(graph, i, j, predecessors))
+                for (VertexIndex vertex: geodesic)
+                    if (vertex != i && vertex != j)
+                        expectedValues[vertex]++;
+    }
+    EXPECT_EQ(getBetweennessCentralities(graph, false), expectedValues);
+}
+
+TEST_F(TreeLikeGraph, when_computingBetweenessesWithThreads_expect_sameBetweenesses){
+    auto expectedValues = getBetweennessCentralities(graph, true);
+    auto betweennesses = getBetweennessCentralities(graph, true, 3);
+    for (VertexIndex vertex: graph)
+        EXPECT_DOUBLE_EQ(betweennesses[vertex], expectedValues[vertex]);
+}
+
+TEST_F(TreeLikeGraph, when_computingBetweenessesOfSourceSubsets_expect_partialResultsAddUp){
+    auto expectedValues = getBetweennessCentralities(graph, false);
+    auto firstShard = getBetweennessCentralities(graph, {0, 2, 4, 6}, false, 2);
+    auto secondShard = getBetweennessCentralities(graph, {1, 3, 5, 7}, false, 2);
+    for (VertexIndex vertex: graph)
+        EXPECT_DOUBLE_EQ(firstShard[vertex]+secondShard[vertex], expectedValues[vertex]);
+
+    EXPECT_EQ(getBetweennessCentralities(graph, vector<VertexIndex>(), true), vector<double>(graph.getSize(), 0));
+}
+
+TEST_F(TreeLikeGraph, when_computingBetweenessesOfSourceOutOfRange_expect_throwOutOfRange){
+    EXPECT_THROW(getBetweennessCentralities(graph, {0, 8}, true, 2), std::out_of_range);
+}
+
+TEST(UndirectedBetweenness, when_graphHasMultiedges_expect_geodesicsCountedOnce){
+    UndirectedGraph graph(4);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(1, 0, true);
+    graph.addEdgeIdx(1, 2);
+    graph.addEdgeIdx(0, 3);
+    graph.addEdgeIdx(3, 2);
+
+    EXPECT_EQ(getBetweennessCentralities(graph, true), vector<double>({.5, .5, .5, .5}));
+    EXPECT_EQ(getBetweennessCentralities(graph, false), vector<double>({1, 1, 1, 1}));
+}
+
+TEST(UndirectedBetweenness, when_computingEdgeBetweenesses_expect_fractionOfGeodesicsThroughEdges){
+    UndirectedGraph graph(5);
+    graph.addEdgeIdx(0, 1);
+    graph.addEdgeIdx(2, 1);
+    graph.addEdgeIdx(0, 3);
+    graph.addEdgeIdx(3, 2);
+    graph.addEdgeIdx(2, 4);
+
+    map<Edge, double> expectedValues = {{{0, 1}, 2.5}, {{1, 2}, 3.5}, {{0, 3}, 2.5}, {{2, 3}, 3.5}, {{2, 4}, 4}};
+    EXPECT_EQ(getEdgeBetweennessCentralities(graph, true), expectedValues);
+
+    expectedValues = {{{0, 1}, 4}, {{1, 2}, 5}, {{0, 3}, 4}, {{2, 3}, 5}, {{2, 4}, 5}};
+    EXPECT_EQ(getEdgeBetweennessCentralities(graph, false), expectedValues);
+}
+
 TEST_F(UndirectedHouseGraph, expect_correctTriangleCount){
     EXPECT_EQ(countTrianglesAroundVertexIdx(graph, 0), 1);
     EXPECT_EQ(countTrianglesAroundVertexIdx(graph, 1), 2);
@@ -0,0 +1,46 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "BaseGraph/algorithms/randomgraphs.h"
+#include "BaseGraph/metrics/general.h"
+
+
+using namespace std;
+
+
+TEST(ApproximateBetweenness, when_seedingRng_expect_sameEstimates){
+    BaseGraph::rng.seed(0);
+    BaseGraph::UndirectedGraph graph = BaseGraph::generateErdosRenyiGraph(100, .05);
+
+    BaseGraph::rng.seed(1);
+    auto estimates = BaseGraph::getApproximateBetweennessCentralities(graph, 20, 4);
+    BaseGraph::rng.seed(1);
+    EXPECT_EQ(BaseGraph::getApproximateBetweennessCentralities(graph, 20, 4), estimates);
+}
+
+TEST(ApproximateBetweenness, when_sampleSizeIsGraphSize_expect_exactBetweennesses){
+    BaseGraph::rng.seed(0);
+    BaseGraph::UndirectedGraph graph = BaseGraph::generateErdosRenyiGraph(50, .1);
+
+    EXPECT_EQ(BaseGraph::getApproximateBetweennessCentralities(graph, 50), BaseGraph::getBetweennessCentralities(graph));
+}
+
+TEST(ApproximateBetweenness, when_samplingSources_expect_estimatesCloseToBetweennesses){
+    BaseGraph::rng.seed(0);
+    size_t n = 400;
+    BaseGraph::UndirectedGraph graph = BaseGraph::generateErdosRenyiGraph(n, .02);
+
+    auto betweennesses = BaseGraph::getBetweennessCentralities(graph, true, 4);
+    auto estimates = BaseGraph::getApproximateBetweennessCentralities(graph, 100, 4);
+    for (BaseGraph::VertexIndex vertex: graph)
+        EXPECT_LE(fabs(estimates[vertex]-betweennesses[vertex]), .05*n*(n-2)/2);
+}
+
+TEST(ApproximateBetweenness, when_computingSampleSize_expect_hoeffdingBound){
+    EXPECT_EQ(BaseGraph::getBetweennessSampleSize(1000, .1, .1), (size_t) ceil(log(2e4)/.02));
+    EXPECT_THROW(BaseGraph::getBetweennessSampleSize(1000, 0, .1), invalid_argument);
+    EXPECT_THROW(BaseGraph::getBetweennessSampleSize(1000, .1, 1), invalid_argument);
+    EXPECT_THROW(BaseGraph::getApproximateBetweennessCentralities(BaseGraph::UndirectedGraph(10), 0), invalid_argument);
+}